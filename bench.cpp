@@ -0,0 +1,112 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+#include <chrono>      // system_clock
+#include <thread>      // hardware_concurrency
+#include <string>
+
+#include "cannon.h"
+#include "cannonTuning.h"
+#include "workStealingPool.h"
+
+using namespace std;
+
+struct Run {
+    const char*       name;
+    cannon::Engine    engine;
+    cannon::Precision precision;
+};
+static const Run runs[] = {
+    { "serial", cannon::Engine::Serial, cannon::Precision::Int32 },
+    { "serial-int16", cannon::Engine::Serial, cannon::Precision::Int16 },
+    { "serial-int8", cannon::Engine::Serial, cannon::Precision::Int8 },
+    { "openmp", cannon::Engine::OpenMP, cannon::Precision::Int32 },
+    { "openmp-tasks", cannon::Engine::OpenMPTasks, cannon::Precision::Int32 },
+    { "pool", cannon::Engine::Pool, cannon::Precision::Int32 },
+};
+
+// Tunes every engine for n x n products and records the winners in the
+// tuning file ($CANNON_TUNING_FILE or cannon_tuning.txt)
+static int autotuneAll(int matrixSize) {
+    string path = cannon::defaultTuningFile();
+    cout << "autotuning n=" << matrixSize << " on " << cannon::cpuModel()
+        << " into " << path << "\n";
+    for (const Run& run : runs) {
+        // layouts are tuned per engine, at full precision
+        if (run.precision != cannon::Precision::Int32)
+            continue;
+        cannon::Options options;
+        options.engine = run.engine;
+        try {
+            cannon::Tuning tuned = cannon::autotune(matrixSize, options, path);
+            cout << run.name << ": processes=" << tuned.processCount
+                << " threads=" << tuned.threadCount
+                << " tiles=" << tuned.tiling.rows << "x" << tuned.tiling.inner
+                << "x" << tuned.tiling.cols << "\n";
+        }
+        catch (const invalid_argument& error) {
+            cout << run.name << ": skipped (" << error.what() << ")\n";
+        }
+    }
+    return 0;
+}
+
+// Times every shared-memory engine on random n x n products.
+// usage: cannon_bench [n] [processCount] [threads] [repetitions]
+//        cannon_bench --autotune [n]
+int main(int argc, char** argv) {
+    if (argc > 1 && string(argv[1]) == "--autotune")
+        return autotuneAll(argc > 2 ? atoi(argv[2]) : 512);
+
+    int matrixSize = argc > 1 ? atoi(argv[1]) : 512;
+    int processCount = argc > 2 ? atoi(argv[2]) : 16;
+    int threadCount = argc > 3 ? atoi(argv[3]) : 0;
+    int repetitions = argc > 4 ? atoi(argv[4]) : 3;
+    if (threadCount <= 0)
+        threadCount = max(1u, thread::hardware_concurrency());
+
+    vector<int> matrixA(matrixSize * matrixSize),
+        matrixB(matrixSize * matrixSize),
+        matrixC(matrixSize * matrixSize);
+    srand(1);
+    for (int i = 0; i < matrixSize * matrixSize; ++i) {
+        matrixA[i] = rand() % 20;
+        matrixB[i] = rand() % 20;
+    }
+    cannon::ConstMatrixView viewA(matrixA.data(), matrixSize),
+        viewB(matrixB.data(), matrixSize);
+    cannon::MatrixView viewC(matrixC.data(), matrixSize);
+
+    WorkStealingPool pool(threadCount);
+
+    cout << "n=" << matrixSize << " processes=" << processCount
+        << " threads=" << threadCount << "\n";
+    for (const Run& run : runs) {
+        cannon::Options options;
+        options.engine = run.engine;
+        options.precision = run.precision;
+        options.processCount = processCount;
+        options.threadCount = threadCount;
+        options.pool = &pool;
+
+        double best = -1;
+        try {
+            for (int rep = 0; rep < repetitions; ++rep) {
+                auto start = chrono::high_resolution_clock::now();
+                cannon::multiply(viewA, viewB, viewC, options);
+                auto stop = chrono::high_resolution_clock::now();
+                double ms = chrono::duration<double, milli>(stop - start).count();
+                if (best < 0 || ms < best)
+                    best = ms;
+            }
+        }
+        catch (const invalid_argument& error) {
+            cout << run.name << ": skipped (" << error.what() << ")\n";
+            continue;
+        }
+        double gflops = 2.0 * matrixSize * matrixSize * matrixSize / (best * 1e6);
+        cout << run.name << ": " << best << " ms, " << gflops << " GFLOP/s\n";
+    }
+    return 0;
+}
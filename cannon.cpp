@@ -0,0 +1,111 @@
+#include "cannon.h"
+
+#include <stdexcept>
+
+#include "cannonGrid.h"
+#include "cannonTuning.h"
+
+using namespace std;
+
+namespace cannon {
+
+using namespace detail;
+
+bool multiply(ConstMatrixView A,
+    ConstMatrixView B,
+    MatrixView C,
+    const Options& requested)
+{
+    int n = A.rows;
+    if (A.cols != n || B.rows != n || B.cols != n || C.rows != n || C.cols != n)
+        throw invalid_argument("cannon::multiply: A, B and C must all be n x n");
+    if (n < 1 || requested.processCount < 1)
+        throw invalid_argument("cannon::multiply: n and processCount must be positive");
+
+    if (requested.sparseDensity > 0 && requested.precision != Precision::Int32)
+        throw invalid_argument("cannon::multiply: sparseDensity needs Precision::Int32");
+    if (requested.semiring != Semiring::PlusTimes && requested.precision != Precision::Int32)
+        throw invalid_argument("cannon::multiply: semirings other than PlusTimes need Precision::Int32");
+    if (!fitsSemiring(A, requested.semiring) || !fitsSemiring(B, requested.semiring))
+        throw invalid_argument("cannon::multiply: entries must lie in [-infinity, infinity]");
+    if (requested.modulus != 0) {
+        if (requested.modulus < 2 || requested.semiring != Semiring::PlusTimes
+                || requested.precision != Precision::Int32 || requested.sparseDensity > 0)
+            throw invalid_argument("cannon::multiply: modulus must be at least 2, with PlusTimes, Int32 and no sparseDensity");
+        if (!fitsModulus(A, requested.modulus) || !fitsModulus(B, requested.modulus))
+            throw invalid_argument("cannon::multiply: entries must lie in [0, modulus)");
+    }
+    if (requested.precision != Precision::Int32) {
+        if (requested.engine != Engine::Serial)
+            throw invalid_argument("cannon::multiply: Int16 and Int8 need Engine::Serial");
+        if (!fitsPrecision(A, requested.precision) || !fitsPrecision(B, requested.precision))
+            throw invalid_argument("cannon::multiply: an entry of A or B does not fit the precision");
+    }
+
+    // Tuned layout and kernel tiling for this machine, if there are any
+    Options options = requested;
+    if (!options.tuningFile.empty()) {
+        loadLayout(options.tuningFile, options.engine, n,
+            options.processCount, options.threadCount);
+        const KernelTiling& tiling = options.tiling;
+        if (tiling.rows == 0 && tiling.inner == 0 && tiling.cols == 0)
+            loadKernelTiling(options.tuningFile,
+                gridLayout(n, options.processCount).blockSize, options.tiling);
+    }
+
+    BlockKernel kernel;
+    kernel.tiling = options.tiling;
+    kernel.sparseDensity = options.sparseDensity;
+    kernel.semiring = options.semiring;
+    if (options.modulus != 0)
+        kernel.modulus = Modulus(options.modulus);
+    else if (options.semiring == Semiring::PlusTimes && needsWideSums(A, B)) {
+        // the narrow kernels add in int, so the product runs in Int32
+        kernel.wideSums = true;
+        options.precision = Precision::Int32;
+    }
+
+    // The engines read A and B and write C in place, holding nothing but
+    // the blocks
+    bool finished = true;
+    BlockFlags overflowed;
+    switch (options.engine) {
+    case Engine::Serial:
+        multiplySerial(A, B, C, options.processCount,
+            kernel, options.precision, overflowed);
+        break;
+    case Engine::OpenMP:
+    case Engine::OpenMPTasks:
+#ifdef CANNON_WITH_OPENMP
+        if (options.engine == Engine::OpenMP)
+            multiplyOmp(A, B, C, options.processCount,
+                options.threadCount, options.affinity, kernel, overflowed);
+        else
+            multiplyOmpTasks(A, B, C, options.processCount,
+                options.threadCount, kernel, overflowed);
+        break;
+#else
+        throw invalid_argument("cannon::multiply: library built without OpenMP");
+#endif
+    case Engine::Pool:
+        if (!options.pool)
+            throw invalid_argument("cannon::multiply: Engine::Pool needs options.pool");
+        finished = multiplyPool(A, B, C,
+            options.processCount, *options.pool, kernel, overflowed);
+        break;
+    }
+
+    if (finished && options.checkOverflow) {
+        string blocks;
+        for (size_t r = 0; r < overflowed.size(); ++r)
+            for (size_t c = 0; c < overflowed[r].size(); ++c)
+                if (overflowed[r][c])
+                    blocks += " (" + to_string(r) + ", " + to_string(c) + ")";
+        if (!blocks.empty())
+            throw overflow_error("cannon::multiply: sums left the int range in C blocks" + blocks);
+    }
+
+    return finished;
+}
+
+} // namespace cannon
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <string>
+
+class WorkStealingPool;
+
+// Cannon's algorithm for C = A x B on square int matrices.
+//
+// The shared-memory engines emulate a grid of processCount virtual Cannon
+// processes (gridSize = ceil(sqrt(processCount)), padding A and B with
+// zeros as needed). The distributed engine lives in cannonMpi.h.
+namespace cannon {
+
+// A rows x cols matrix inside a caller-owned buffer:
+// element (r, c) lives at data[r * stride + c]
+struct MatrixView {
+    int* data = nullptr;
+    int  rows = 0;
+    int  cols = 0;
+    int  stride = 0;
+
+    MatrixView() = default;
+    MatrixView(int* data, int rows, int cols, int stride)
+        : data(data), rows(rows), cols(cols), stride(stride) {}
+    // contiguous n x n
+    MatrixView(int* data, int n) : MatrixView(data, n, n, n) {}
+
+    int& operator()(int r, int c) const { return data[size_t(r) * stride + c]; }
+};
+
+struct ConstMatrixView {
+    const int* data = nullptr;
+    int        rows = 0;
+    int        cols = 0;
+    int        stride = 0;
+
+    ConstMatrixView() = default;
+    ConstMatrixView(const int* data, int rows, int cols, int stride)
+        : data(data), rows(rows), cols(cols), stride(stride) {}
+    ConstMatrixView(const int* data, int n) : ConstMatrixView(data, n, n, n) {}
+    ConstMatrixView(MatrixView view)
+        : ConstMatrixView(view.data, view.rows, view.cols, view.stride) {}
+
+    const int& operator()(int r, int c) const { return data[size_t(r) * stride + c]; }
+};
+
+enum class Engine {
+    Serial,       // one thread, rotations done in place
+    OpenMP,       // one persistent team, worksharing loops + barriers
+    OpenMPTasks,  // per-block task dataflow, no grid-wide barriers
+    Pool          // work-stealing WorkStealingPool, no OpenMP runtime
+};
+
+// Element type A and B are stored, shifted and multiplied as; products
+// are always accumulated into int. Int16 and Int8 suit quantized inputs
+// and need every entry of A and B to fit, multiply throws otherwise.
+enum class Precision { Int32, Int16, Int8 };
+
+// What the product adds and multiplies with:
+//   PlusTimes   (+, x)     the ordinary integer product
+//   MinPlus     (min, +)   shortest paths; infinity means no edge
+//   MaxPlus     (max, +)   longest paths; -infinity means no edge
+//   BoolOrAnd   (or, and)  reachability; non-zero is true, C is 0 or 1
+// Anything other than PlusTimes needs Precision::Int32.
+enum class Semiring { PlusTimes, MinPlus, MaxPlus, BoolOrAnd };
+
+// "No edge" for MinPlus (-infinity for MaxPlus). Entries must lie in
+// [-infinity, infinity], so adding two of them cannot overflow.
+const int infinity = INT_MAX / 2;
+
+// Thread placement for Engine::OpenMP; set OMP_PLACES (e.g. cores) so
+// the runtime knows what to bind to
+enum class Affinity { None, Compact, Scatter };
+
+// Loop tiling of the local block multiply C += A x B (b x b blocks):
+// rows of C, the shared k dimension and columns of C are walked in tiles
+// of this many elements. 0 leaves that loop untiled.
+struct KernelTiling {
+    int rows = 0;
+    int inner = 0;
+    int cols = 0;
+};
+
+struct Options {
+    Engine   engine = Engine::Serial;
+    int      processCount = 1;          // virtual Cannon processes
+    int      threadCount = 0;           // OpenMP engines, 0 = one per core
+    Affinity affinity = Affinity::None;
+    WorkStealingPool* pool = nullptr;   // required by Engine::Pool
+    KernelTiling tiling;
+    Precision precision = Precision::Int32;   // narrow: Engine::Serial only
+    // Above zero, products where the A or B block holds nothing but the
+    // semiring's zero (0, or +-infinity for MinPlus/MaxPlus) are skipped,
+    // and A blocks with at most this fraction of other entries are
+    // multiplied entry by entry. Int32 precision only
+    double   sparseDensity = 0;
+    Semiring semiring = Semiring::PlusTimes;
+    // Above zero, C = A x B mod this (at most INT_MAX), exact however
+    // large the true sums get. Entries of A and B must lie in
+    // [0, modulus); PlusTimes, Int32 and no sparseDensity only
+    int      modulus = 0;
+    // PlusTimes products whose sums could pass INT_MAX (n * max|A| *
+    // max|B| does) are accumulated in 64 bits, in Int32 precision, so C
+    // is right wherever its entries fit an int. If set, multiply also
+    // throws std::overflow_error naming the C blocks where a running sum
+    // left the int range; C then holds the low 32 bits of each sum
+    bool     checkOverflow = false;
+    // If set, the layout (processCount, threadCount) and, while tiling
+    // is left at zero, the kernel tiling are taken from this tuning file
+    // when it has an entry for this CPU, engine and n (see cannonTuning.h)
+    std::string tuningFile;
+};
+
+// Computes C = A x B. A, B and C must all be n x n; C is written only
+// after A and B have been read, so it may share storage with them.
+// Returns false if Engine::Pool was cancelled, C is then unspecified.
+// Throws std::invalid_argument on mismatched shapes or options, e.g. an
+// OpenMP engine in a library built without OpenMP, and
+// std::overflow_error as described for Options::checkOverflow.
+bool multiply(ConstMatrixView A,
+    ConstMatrixView B,
+    MatrixView C,
+    const Options& options = Options());
+
+} // namespace cannon
@@ -0,0 +1,497 @@
+#include "cannonGrid.h"
+
+#include <algorithm>   // copy, fill_n, min
+#include <cmath>       // sqrt, ceil, floor
+#include <limits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace cannon {
+namespace detail {
+
+GridLayout gridLayout(int matrixSize, int processCount)
+{
+    // 1) Determine gridSize: if processCount is a perfect square,
+    //    use exact sqrt; otherwise ceil(sqrt)
+    double sqrtP = sqrt(double(processCount));
+    int    nearestRoot = int(floor(sqrtP + 0.5));
+    bool   isSquare = (nearestRoot * nearestRoot == processCount);
+    int    gridSize = isSquare ? nearestRoot
+        : int(ceil(sqrtP));
+
+    // 2) Determine blockSize so gridSize*blockSize >= matrixSize
+    bool dividesEvenly = (matrixSize % gridSize == 0);
+    int  blockSize = dividesEvenly
+        ? matrixSize / gridSize
+        : int(ceil(double(matrixSize) / gridSize));
+
+    return { gridSize, blockSize, gridSize * blockSize,
+        !(isSquare && dividesEvenly) };
+}
+
+void loadBlock(ConstMatrixView matrix, int blockRow, int blockCol,
+    int blockSize, int fill, Block& block)
+{
+    int N = matrix.rows;
+    int colBegin = blockCol * blockSize;
+    int width = max(0, min(blockSize, N - colBegin));
+    block.resize(blockSize);
+    for (int i = 0; i < blockSize; ++i) {
+        vector<int>& row = block[i];
+        row.resize(blockSize);
+        int r = blockRow * blockSize + i;
+        int inside = r < N ? width : 0;
+        if (inside > 0) {
+            const int* from = &matrix(r, colBegin);
+            copy(from, from + inside, row.begin());
+        }
+        fill_n(row.begin() + inside, blockSize - inside, fill);
+    }
+}
+
+void storeBlock(const Block& block, int blockRow, int blockCol,
+    MatrixView matrix)
+{
+    int N = matrix.rows;
+    int blockSize = block.size();
+    int colBegin = blockCol * blockSize;
+    int width = min(blockSize, N - colBegin);
+    int height = min(blockSize, N - blockRow * blockSize);
+    if (width <= 0) return;
+    for (int i = 0; i < height; ++i)
+        copy(block[i].begin(), block[i].begin() + width,
+            &matrix(blockRow * blockSize + i, colBegin));
+}
+
+Grid makeBlocks(ConstMatrixView matrix, int gridSize, int blockSize, int fill)
+{
+    Grid blocks(gridSize, vector<Block>(gridSize));
+    for (int r = 0; r < gridSize; ++r)
+        for (int c = 0; c < gridSize; ++c)
+            loadBlock(matrix, r, c, blockSize, fill, blocks[r][c]);
+    return blocks;
+}
+
+void assemble(const Grid& blocks, MatrixView matrix)
+{
+    int gridSize = blocks.size();
+    for (int r = 0; r < gridSize; ++r)
+        for (int c = 0; c < gridSize; ++c)
+            storeBlock(blocks[r][c], r, c, matrix);
+}
+
+template <typename T>
+void toBlocks(ConstMatrixView view, T* arena, int gridSize, int blockSize)
+{
+    size_t blockLength = size_t(blockSize) * blockSize;
+    for (int blockRow = 0; blockRow < gridSize; ++blockRow) {
+        int rowBegin = blockRow * blockSize;
+        int rowEnd = min(rowBegin + blockSize, view.rows);
+        for (int blockCol = 0; blockCol < gridSize; ++blockCol) {
+            int colBegin = blockCol * blockSize;
+            int width = min(blockSize, view.cols - colBegin);
+            if (width <= 0) continue;
+            T* block = arena + (blockRow * gridSize + blockCol) * blockLength;
+            for (int r = rowBegin; r < rowEnd; ++r) {
+                const int* from = view.data + size_t(r) * view.stride + colBegin;
+                copy(from, from + width, block + size_t(r - rowBegin) * blockSize);
+            }
+        }
+    }
+}
+
+template void toBlocks<int>(ConstMatrixView, int*, int, int);
+template void toBlocks<int16_t>(ConstMatrixView, int16_t*, int, int);
+template void toBlocks<int8_t>(ConstMatrixView, int8_t*, int, int);
+
+int semiringZero(Semiring semiring)
+{
+    switch (semiring) {
+    case Semiring::MinPlus: return MinPlus::zero();
+    case Semiring::MaxPlus: return MaxPlus::zero();
+    default:                return 0;
+    }
+}
+
+Modulus::Modulus(int modulus)
+    : p(modulus), barrett(UINT64_MAX / p)
+{
+    // a reduced sum is at most p - 1 and every product at most (p - 1)^2
+    uint64_t largest = (p - 1) * (p - 1);
+    uint64_t products = (UINT64_MAX - (p - 1)) / largest;
+    deferred = int(min<uint64_t>(products, INT_MAX));
+}
+
+// Row i of C (+)= row i of A times B modulo modulus.p, with rowsB[k] row k
+// of B. acc holds blockSize 64-bit sums, reduced every modulus.deferred
+// non-zero a; entries of C are reduced on the way in and out.
+static void accumulateRowMod(const int* rowA, const int* const* rowsB,
+    int* rowC, int blockSize, const Modulus& modulus, uint64_t* acc)
+{
+    for (int j = 0; j < blockSize; ++j)
+        acc[j] = uint32_t(rowC[j]);
+    int pending = 0;
+    for (int k = 0; k < blockSize; ++k) {
+        uint64_t a = uint32_t(rowA[k]);
+        if (a == 0) continue;
+        if (pending == modulus.deferred) {
+            for (int j = 0; j < blockSize; ++j)
+                acc[j] = modulus.reduce(acc[j]);
+            pending = 0;
+        }
+        // 32 x 32 -> 64-bit multiplies, vpmuludq once vectorised
+        const int* rowB = rowsB[k];
+        for (int j = 0; j < blockSize; ++j)
+            acc[j] += a * uint32_t(rowB[j]);
+        ++pending;
+    }
+    for (int j = 0; j < blockSize; ++j)
+        rowC[j] = int(modulus.reduce(acc[j]));
+}
+
+void multiplyAccMod(const int* A, const int* B, int* C, int blockSize,
+    int rowBegin, int rowEnd, const Modulus& modulus)
+{
+    vector<const int*> rowsB(blockSize);
+    for (int k = 0; k < blockSize; ++k)
+        rowsB[k] = B + size_t(k) * blockSize;
+    vector<uint64_t> acc(blockSize);
+    for (int i = rowBegin; i < rowEnd; ++i)
+        accumulateRowMod(A + size_t(i) * blockSize, rowsB.data(),
+            C + size_t(i) * blockSize, blockSize, modulus, acc.data());
+}
+
+// Row i of C += row i of A times B in 64 bits; see multiplyAccWide.
+// The sums wrap as unsigned so nothing is undefined past 2^63.
+template <typename T>
+static bool accumulateRowWide(const T* rowA, const T* const* rowsB,
+    int* rowC, int blockSize, uint64_t* acc)
+{
+    for (int j = 0; j < blockSize; ++j)
+        acc[j] = uint64_t(int64_t(rowC[j]));
+    for (int k = 0; k < blockSize; ++k) {
+        int64_t a = rowA[k];
+        if (a == 0) continue;
+        const T* rowB = rowsB[k];
+        for (int j = 0; j < blockSize; ++j)
+            acc[j] += uint64_t(a * rowB[j]);
+    }
+    bool overflowed = false;
+    for (int j = 0; j < blockSize; ++j) {
+        int64_t sum = int64_t(acc[j]);
+        overflowed |= sum < INT_MIN || sum > INT_MAX;
+        rowC[j] = int(uint32_t(acc[j]));
+    }
+    return overflowed;
+}
+
+template <typename T>
+bool multiplyAccWide(const T* A, const T* B, int* C, int blockSize,
+    int rowBegin, int rowEnd)
+{
+    vector<const T*> rowsB(blockSize);
+    for (int k = 0; k < blockSize; ++k)
+        rowsB[k] = B + size_t(k) * blockSize;
+    vector<uint64_t> acc(blockSize);
+    bool overflowed = false;
+    for (int i = rowBegin; i < rowEnd; ++i)
+        overflowed |= accumulateRowWide(A + size_t(i) * blockSize, rowsB.data(),
+            C + size_t(i) * blockSize, blockSize, acc.data());
+    return overflowed;
+}
+
+template bool multiplyAccWide<int>(const int*, const int*, int*, int, int, int);
+template bool multiplyAccWide<int16_t>(const int16_t*, const int16_t*, int*,
+    int, int, int);
+template bool multiplyAccWide<int8_t>(const int8_t*, const int8_t*, int*,
+    int, int, int);
+
+int64_t maxAbs(ConstMatrixView view)
+{
+    int64_t largest = 0;
+    for (int r = 0; r < view.rows; ++r)
+        for (int c = 0; c < view.cols; ++c)
+            largest = max(largest, view(r, c) < 0 ? -int64_t(view(r, c)) : int64_t(view(r, c)));
+    return largest;
+}
+
+bool needsWideSums(ConstMatrixView A, ConstMatrixView B)
+{
+    return double(A.rows) * double(maxAbs(A)) * double(maxAbs(B)) > INT_MAX;
+}
+
+// Entries of a block other than zero, counting no further than limit
+static int countNonZeros(const Block& block, int zero, int limit)
+{
+    int count = 0;
+    for (const vector<int>& row : block) {
+        for (int value : row)
+            count += value != zero;
+        if (count > limit)
+            break;
+    }
+    return count;
+}
+
+template <typename S>
+static void multiplyAccAs(const Block& A, const Block& B, Block& C,
+    const BlockKernel& kernel)
+{
+    int blockSize = A.size();
+    if (kernel.sparseDensity > 0) {
+        int sparseLimit = int(kernel.sparseDensity * blockSize * blockSize);
+        int nonZerosA = countNonZeros(A, S::zero(), sparseLimit);
+        if (nonZerosA == 0 || countNonZeros(B, S::zero(), 0) == 0)
+            return;
+        if (nonZerosA <= sparseLimit) {
+            // i-k-j over the non-zeros of A only
+            for (int i = 0; i < blockSize; ++i) {
+                int* rowC = C[i].data();
+                for (int k = 0; k < blockSize; ++k) {
+                    int a = A[i][k];
+                    if (a == S::zero()) continue;
+                    const int* rowB = B[k].data();
+                    for (int j = 0; j < blockSize; ++j)
+                        rowC[j] = S::mulAdd(rowC[j], a, rowB[j]);
+                }
+            }
+            return;
+        }
+    }
+
+    // an untiled row dimension is walked one row at a time, which gives
+    // the plain i-k-j loop
+    const KernelTiling& tiling = kernel.tiling;
+    int tileRows = tiling.rows > 0 ? tiling.rows : 1;
+    int tileInner = tiling.inner > 0 ? tiling.inner : blockSize;
+    int tileCols = tiling.cols > 0 ? tiling.cols : blockSize;
+    for (int i0 = 0; i0 < blockSize; i0 += tileRows) {
+        int iEnd = min(i0 + tileRows, blockSize);
+        for (int k0 = 0; k0 < blockSize; k0 += tileInner) {
+            int kEnd = min(k0 + tileInner, blockSize);
+            for (int j0 = 0; j0 < blockSize; j0 += tileCols) {
+                int jEnd = min(j0 + tileCols, blockSize);
+                for (int i = i0; i < iEnd; ++i) {
+                    int* rowC = C[i].data();
+                    for (int k = k0; k < kEnd; ++k) {
+                        int a = A[i][k];
+                        if (a == S::zero()) continue;
+                        const int* rowB = B[k].data();
+                        for (int j = j0; j < jEnd; ++j)
+                            rowC[j] = S::mulAdd(rowC[j], a, rowB[j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool multiplyAcc(const Block& A, const Block& B, Block& C,
+    const BlockKernel& kernel)
+{
+    if (kernel.modulus.p != 0 || kernel.wideSums) {
+        int blockSize = A.size();
+        vector<const int*> rowsB(blockSize);
+        for (int k = 0; k < blockSize; ++k)
+            rowsB[k] = B[k].data();
+        vector<uint64_t> acc(blockSize);
+        bool overflowed = false;
+        for (int i = 0; i < blockSize; ++i) {
+            if (kernel.modulus.p != 0)
+                accumulateRowMod(A[i].data(), rowsB.data(), C[i].data(),
+                    blockSize, kernel.modulus, acc.data());
+            else
+                overflowed |= accumulateRowWide(A[i].data(), rowsB.data(),
+                    C[i].data(), blockSize, acc.data());
+        }
+        return overflowed;
+    }
+    switch (kernel.semiring) {
+    case Semiring::PlusTimes: multiplyAccAs<PlusTimes>(A, B, C, kernel); break;
+    case Semiring::MinPlus:   multiplyAccAs<MinPlus>(A, B, C, kernel); break;
+    case Semiring::MaxPlus:   multiplyAccAs<MaxPlus>(A, B, C, kernel); break;
+    case Semiring::BoolOrAnd: multiplyAccAs<BoolOrAnd>(A, B, C, kernel); break;
+    }
+    return false;
+}
+
+bool fitsPrecision(ConstMatrixView view, Precision precision)
+{
+    int low, high;
+    switch (precision) {
+    case Precision::Int16:
+        low = numeric_limits<int16_t>::min();
+        high = numeric_limits<int16_t>::max();
+        break;
+    case Precision::Int8:
+        low = numeric_limits<int8_t>::min();
+        high = numeric_limits<int8_t>::max();
+        break;
+    default:
+        return true;
+    }
+    for (int r = 0; r < view.rows; ++r)
+        for (int c = 0; c < view.cols; ++c)
+            if (view(r, c) < low || view(r, c) > high)
+                return false;
+    return true;
+}
+
+bool fitsSemiring(ConstMatrixView view, Semiring semiring)
+{
+    if (semiring != Semiring::MinPlus && semiring != Semiring::MaxPlus)
+        return true;
+    for (int r = 0; r < view.rows; ++r)
+        for (int c = 0; c < view.cols; ++c)
+            if (view(r, c) < -infinity || view(r, c) > infinity)
+                return false;
+    return true;
+}
+
+bool fitsModulus(ConstMatrixView view, int modulus)
+{
+    for (int r = 0; r < view.rows; ++r)
+        for (int c = 0; c < view.cols; ++c)
+            if (view(r, c) < 0 || view(r, c) >= modulus)
+                return false;
+    return true;
+}
+
+template <typename S>
+void multiplyAccCsr(const int* rowStart, const int* cols, const int* values,
+    const int* B, int* C, int blockSize, int rowBegin, int rowEnd)
+{
+    for (int i = rowBegin; i < rowEnd; ++i) {
+        int* rowC = C + size_t(i) * blockSize;
+        for (int e = rowStart[i]; e < rowStart[i + 1]; ++e) {
+            int a = values[e];
+            const int* rowB = B + size_t(cols[e]) * blockSize;
+            for (int j = 0; j < blockSize; ++j)
+                rowC[j] = S::mulAdd(rowC[j], a, rowB[j]);
+        }
+    }
+}
+
+template void multiplyAccCsr<PlusTimes>(const int*, const int*, const int*,
+    const int*, int*, int, int, int);
+template void multiplyAccCsr<MinPlus>(const int*, const int*, const int*,
+    const int*, int*, int, int, int);
+template void multiplyAccCsr<MaxPlus>(const int*, const int*, const int*,
+    const int*, int*, int, int, int);
+template void multiplyAccCsr<BoolOrAnd>(const int*, const int*, const int*,
+    const int*, int*, int, int, int);
+
+// Rows k0.. of the k tile for row i, two at a time, for semirings and
+// element types with a paired multiply-add; returns the first k left to
+// do. Without one that is k0
+template <typename S, typename T>
+static int accumulatePairs(S, const T*, const T*, int*, int, int k0, int,
+    int, int)
+{
+    return k0;
+}
+
+#ifdef __AVX2__
+// Eight consecutive entries widened to int16 lanes
+static __m128i loadWide(const int16_t* from)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(from));
+}
+
+static __m128i loadWide(const int8_t* from)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(from)));
+}
+
+// Rows k and k+1 of B interleaved into int16 pairs, times the pair
+// (A[i][k], A[i][k+1]) in every lane: one vpmaddwd per eight columns
+template <typename T>
+static int accumulatePairsAvx2(const T* rowA, const T* B, int* rowC,
+    int blockSize, int k0, int kEnd, int j0, int jEnd)
+{
+    int k = k0;
+    for (; k + 1 < kEnd; k += 2) {
+        const T* rowB0 = B + size_t(k) * blockSize;
+        const T* rowB1 = rowB0 + blockSize;
+        int a0 = rowA[k], a1 = rowA[k + 1];
+        __m256i pairA = _mm256_set1_epi32(
+            int((uint32_t(uint16_t(a1)) << 16) | uint16_t(a0)));
+        int j = j0;
+        for (; j + 8 <= jEnd; j += 8) {
+            __m128i b0 = loadWide(rowB0 + j);
+            __m128i b1 = loadWide(rowB1 + j);
+            __m256i pairsB = _mm256_set_m128i(
+                _mm_unpackhi_epi16(b0, b1), _mm_unpacklo_epi16(b0, b1));
+            __m256i* out = reinterpret_cast<__m256i*>(rowC + j);
+            _mm256_storeu_si256(out, _mm256_add_epi32(
+                _mm256_loadu_si256(out), _mm256_madd_epi16(pairsB, pairA)));
+        }
+        for (; j < jEnd; ++j)
+            rowC[j] += a0 * rowB0[j] + a1 * rowB1[j];
+    }
+    return k;
+}
+
+static int accumulatePairs(PlusTimes, const int16_t* rowA, const int16_t* B,
+    int* rowC, int blockSize, int k0, int kEnd, int j0, int jEnd)
+{
+    return accumulatePairsAvx2(rowA, B, rowC, blockSize, k0, kEnd, j0, jEnd);
+}
+
+static int accumulatePairs(PlusTimes, const int8_t* rowA, const int8_t* B,
+    int* rowC, int blockSize, int k0, int kEnd, int j0, int jEnd)
+{
+    return accumulatePairsAvx2(rowA, B, rowC, blockSize, k0, kEnd, j0, jEnd);
+}
+#endif
+
+template <typename S, typename T>
+void multiplyAccFlat(const T* A, const T* B, int* C, int blockSize,
+    int rowBegin, int rowEnd, const KernelTiling& tiling)
+{
+    int tileRows = tiling.rows > 0 ? tiling.rows : 1;
+    int tileInner = tiling.inner > 0 ? tiling.inner : blockSize;
+    int tileCols = tiling.cols > 0 ? tiling.cols : blockSize;
+    for (int i0 = rowBegin; i0 < rowEnd; i0 += tileRows) {
+        int iEnd = min(i0 + tileRows, rowEnd);
+        for (int k0 = 0; k0 < blockSize; k0 += tileInner) {
+            int kEnd = min(k0 + tileInner, blockSize);
+            for (int j0 = 0; j0 < blockSize; j0 += tileCols) {
+                int jEnd = min(j0 + tileCols, blockSize);
+                for (int i = i0; i < iEnd; ++i) {
+                    const T* rowA = A + size_t(i) * blockSize;
+                    int* rowC = C + size_t(i) * blockSize;
+                    int k = accumulatePairs(S(), rowA, B, rowC, blockSize,
+                        k0, kEnd, j0, jEnd);
+                    for (; k < kEnd; ++k) {
+                        int a = rowA[k];
+                        if (a == S::zero()) continue;
+                        const T* rowB = B + size_t(k) * blockSize;
+                        for (int j = j0; j < jEnd; ++j)
+                            rowC[j] = S::mulAdd(rowC[j], a, rowB[j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template void multiplyAccFlat<PlusTimes, int>(const int*, const int*, int*,
+    int, int, int, const KernelTiling&);
+template void multiplyAccFlat<PlusTimes, int16_t>(const int16_t*,
+    const int16_t*, int*, int, int, int, const KernelTiling&);
+template void multiplyAccFlat<PlusTimes, int8_t>(const int8_t*,
+    const int8_t*, int*, int, int, int, const KernelTiling&);
+template void multiplyAccFlat<MinPlus, int>(const int*, const int*, int*,
+    int, int, int, const KernelTiling&);
+template void multiplyAccFlat<MaxPlus, int>(const int*, const int*, int*,
+    int, int, int, const KernelTiling&);
+template void multiplyAccFlat<BoolOrAnd, int>(const int*, const int*, int*,
+    int, int, int, const KernelTiling&);
+
+} // namespace detail
+} // namespace cannon
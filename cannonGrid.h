@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "cannon.h"
+
+// Internals shared by the shared-memory engines: the block grid the
+// virtual Cannon processes work on and the helpers that build it.
+namespace cannon {
+namespace detail {
+
+// A Block is a blockSize x blockSize matrix of ints
+using Block = std::vector<std::vector<int>>;
+// A Grid is gridSize rows of gridSize Blocks
+using Grid = std::vector<std::vector<Block>>;
+// One flag per block of a grid
+using BlockFlags = std::vector<std::vector<char>>;
+
+// Shape of the virtual process grid for an n x n product
+struct GridLayout {
+    int  gridSize;       // ceil(sqrt(processCount))
+    int  blockSize;      // ceil(n / gridSize)
+    int  paddedSize;     // gridSize * blockSize
+    bool needsPadding;   // processCount not square or n not divisible
+};
+
+GridLayout gridLayout(int matrixSize, int processCount);
+
+// Fill block with block (blockRow, blockCol) of an N x N view as if it
+// were padded with fill to a multiple of blockSize, a block row at a
+// time: one copy of the part inside the matrix, one fill of the rest.
+// Nothing padded is ever built
+void loadBlock(ConstMatrixView matrix, int blockRow, int blockCol,
+    int blockSize, int fill, Block& block);
+
+// Copy the part of block (blockRow, blockCol) that lies inside the
+// N x N view back into it, a block row at a time
+void storeBlock(const Block& block, int blockRow, int blockCol,
+    MatrixView matrix);
+
+// Break an N x N view into gridSize rows of gridSize blocks, each
+// blockSize x blockSize, padded with fill where they pass its edge
+Grid makeBlocks(ConstMatrixView matrix, int gridSize, int blockSize,
+    int fill = 0);
+
+// Copy gridSize rows of gridSize blocks back into an N x N view,
+// dropping the padding
+void assemble(const Grid& blocks, MatrixView matrix);
+
+// A block arena holds all blocks of a gridSize x gridSize grid back to
+// back in grid order (block (r, c) at slot r * gridSize + c), each
+// blockSize x blockSize and row-major, so one block is one contiguous
+// run that can be sent as it is.
+
+// Copy view into an arena of T (int, int16_t or int8_t) one block row at
+// a time; a block row is a plain copy (memmove for int). Cells past the
+// edge of view are left alone, so the arena keeps its padding.
+template <typename T>
+void toBlocks(ConstMatrixView view, T* arena, int gridSize, int blockSize);
+
+// Semiring policies for the kernels. mulAdd(c, a, b) is c (+) a (x) b
+// for an a that is not zero(); zero() is the identity of (+) and
+// annihilates under (x), so zero entries of A are skipped, the padding
+// and a fresh C hold it. The branches are selects, so the j loops still
+// vectorise.
+struct PlusTimes {
+    static int zero() { return 0; }
+    static int mulAdd(int c, int a, int b) { return c + a * b; }
+};
+struct MinPlus {
+    static int zero() { return infinity; }
+    static int mulAdd(int c, int a, int b)
+    {
+        int sum = b == infinity ? infinity : a + b;
+        return sum < c ? sum : c;
+    }
+};
+struct MaxPlus {
+    static int zero() { return -infinity; }
+    static int mulAdd(int c, int a, int b)
+    {
+        int sum = b == -infinity ? -infinity : a + b;
+        return sum > c ? sum : c;
+    }
+};
+struct BoolOrAnd {
+    static int zero() { return 0; }
+    static int mulAdd(int c, int, int b) { return c | (b != 0); }
+};
+
+int semiringZero(Semiring semiring);
+
+// Barrett reduction modulo p (2 <= p < 2^31) of any 64-bit value, and
+// how many products of reduced values a reduced 64-bit sum can take
+// before it could overflow; the modular kernels reduce only that often
+struct Modulus {
+    uint64_t p = 0;          // 0: plain int arithmetic
+    uint64_t barrett = 0;    // floor((2^64 - 1) / p)
+    int      deferred = 0;
+
+    Modulus() = default;
+    explicit Modulus(int modulus);
+
+    uint64_t reduce(uint64_t x) const
+    {
+#ifdef __SIZEOF_INT128__
+        // the quotient estimate is at most two short
+        uint64_t q = uint64_t((unsigned __int128)x * barrett >> 64);
+        uint64_t r = x - q * p;
+        if (r >= p) r -= p;
+        if (r >= p) r -= p;
+        return r;
+#else
+        return x % p;
+#endif
+    }
+};
+
+// Everything the block kernels take besides the blocks
+struct BlockKernel {
+    KernelTiling tiling;
+    double       sparseDensity = 0;   // see Options
+    Semiring     semiring = Semiring::PlusTimes;
+    Modulus      modulus;
+    bool         wideSums = false;    // PlusTimes in 64 bits, see needsWideSums
+};
+
+// Largest |entry| of view
+int64_t maxAbs(ConstMatrixView view);
+
+// True if an n x n PlusTimes product of A and B might hold a sum outside
+// the int range: n * max|A| * max|B| > INT_MAX
+bool needsWideSums(ConstMatrixView A, ConstMatrixView B);
+
+// Multiply two blockSize x blockSize blocks A and B into C in
+// kernel.semiring. With a sparseDensity above zero the product is
+// skipped when A or B holds only zero(), and a sparse enough A is walked
+// entry by entry. With wideSums, returns true if a sum left the int range
+bool multiplyAcc(const Block& A, const Block& B, Block& C,
+    const BlockKernel& kernel);
+
+// Multiply-accumulate rows [rowBegin, rowEnd) of two flat row-major
+// blocks of T (int, int16_t or int8_t) into int C with 64-bit sums; true if one of them, C included, is
+// outside the int range. C keeps the low 32 bits, which is all later
+// steps need: the final C is exact wherever its entries fit an int.
+// Sums past 2^63 within one call (b * max|A| * max|B|) are not detected.
+template <typename T>
+bool multiplyAccWide(const T* A, const T* B, int* C, int blockSize,
+    int rowBegin, int rowEnd);
+
+// Multiply-accumulate rows [rowBegin, rowEnd) of two flat row-major
+// int blocks into C modulo modulus.p. Rows of C are summed in 64 bits
+// and reduced every modulus.deferred products, so the j loop is a plain
+// widening multiply-add. Tiling does not apply.
+void multiplyAccMod(const int* A, const int* B, int* C, int blockSize,
+    int rowBegin, int rowEnd, const Modulus& modulus);
+
+// Multiply-accumulate rows [rowBegin, rowEnd) of a blockSize x blockSize
+// CSR block (rowStart has blockSize + 1 offsets into cols and values)
+// times a flat row-major int block into C, in semiring S
+template <typename S>
+void multiplyAccCsr(const int* rowStart, const int* cols, const int* values,
+    const int* B, int* C, int blockSize, int rowBegin, int rowEnd);
+
+// True if every entry of view fits the element type of precision, and
+// lies in [-infinity, infinity] for MinPlus and MaxPlus
+bool fitsPrecision(ConstMatrixView view, Precision precision);
+bool fitsSemiring(ConstMatrixView view, Semiring semiring);
+// True if every entry of view lies in [0, modulus)
+bool fitsModulus(ConstMatrixView view, int modulus);
+
+// Multiply-accumulate rows [rowBegin, rowEnd) of two flat row-major
+// blockSize x blockSize blocks of T into an int block, in semiring S.
+// T is int for every semiring, int16_t or int8_t for PlusTimes. Built
+// for AVX2 (CANNON_ARCH=avx2 or native) the narrow types take two k at
+// a time through one vpmaddwd, eight columns per instruction.
+template <typename S, typename T>
+void multiplyAccFlat(const T* A, const T* B, int* C, int blockSize,
+    int rowBegin, int rowEnd, const KernelTiling& tiling);
+
+// The engines behind cannon::multiply. Each computes C = A x B, loading
+// blocks straight from the n x n views A and B and storing them straight
+// into the n x n view C once every block is done (so C may alias A or
+// B), and sets overflowed to the gridSize x gridSize flags of the C
+// blocks where multiplyAcc reported a sum outside the int range
+void multiplySerial(ConstMatrixView matrixA, ConstMatrixView matrixB,
+    MatrixView matrixC, int processCount, const BlockKernel& kernel,
+    Precision precision, BlockFlags& overflowed);
+void multiplyOmp(ConstMatrixView matrixA, ConstMatrixView matrixB,
+    MatrixView matrixC, int processCount, int threadCount, Affinity affinity,
+    const BlockKernel& kernel, BlockFlags& overflowed);
+void multiplyOmpTasks(ConstMatrixView matrixA, ConstMatrixView matrixB,
+    MatrixView matrixC, int processCount, int threadCount,
+    const BlockKernel& kernel, BlockFlags& overflowed);
+bool multiplyPool(ConstMatrixView matrixA, ConstMatrixView matrixB,
+    MatrixView matrixC, int processCount, WorkStealingPool& pool,
+    const BlockKernel& kernel, BlockFlags& overflowed);
+
+} // namespace detail
+} // namespace cannon
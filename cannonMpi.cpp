@@ -0,0 +1,1741 @@
+#include "cannonMpi.h"
+#include "cannonGrid.h"
+#include "cannonTuning.h"
+
+#include <algorithm>   // fill, min, max, stable_sort
+#include <chrono>      // steady_clock
+#include <cmath>
+#include <cstdio>      // fopen, rename
+#include <cstdlib>     // llabs
+#include <cstring>     // memcpy
+#include <map>
+#include <numeric>     // iota
+#include <random>      // random_device
+#include <stdexcept>
+#include <thread>
+#include <utility>     // move
+#include <vector>
+
+using namespace std;
+
+namespace cannon {
+
+using namespace detail;
+
+// Local C += A x B in semiring S, tiled as configured; the hybrid build
+// (compiled with OpenMP) shares the row tiles among the rank's threads
+template <typename S, typename T>
+static void multiplyBlocks(const T* a, const T* b, std::vector<int>& C,
+    int blockSize, const KernelTiling& tiling)
+{
+    // untiled rows are walked one at a time (the plain i-k-j loop)
+    int tileRows = tiling.rows > 0 ? tiling.rows : 1;
+    #pragma omp parallel for schedule(static)
+    for (int i0 = 0; i0 < blockSize; i0 += tileRows)
+    {
+        multiplyAccFlat<S>(a, b, C.data(), blockSize,
+            i0, std::min(i0 + tileRows, blockSize), tiling);
+    }
+}
+
+// Local C += A x B with 64-bit sums, row tiles shared as above; true if
+// a sum left the int range
+template <typename T>
+static bool multiplyBlocksWide(const T* a, const T* b, std::vector<int>& C,
+    int blockSize, const KernelTiling& tiling)
+{
+    int tileRows = tiling.rows > 0 ? tiling.rows : 1;
+    bool overflowed = false;
+    #pragma omp parallel for schedule(static) reduction(||:overflowed)
+    for (int i0 = 0; i0 < blockSize; i0 += tileRows)
+    {
+        overflowed = multiplyAccWide(a, b, C.data(), blockSize,
+            i0, std::min(i0 + tileRows, blockSize)) || overflowed;
+    }
+    return overflowed;
+}
+
+// Local C += A x B modulo modulus.p, row tiles shared as above
+static void multiplyBlocksMod(const int* a, const int* b, std::vector<int>& C,
+    int blockSize, const KernelTiling& tiling, const Modulus& modulus)
+{
+    int tileRows = tiling.rows > 0 ? tiling.rows : 1;
+    #pragma omp parallel for schedule(static)
+    for (int i0 = 0; i0 < blockSize; i0 += tileRows)
+    {
+        multiplyAccMod(a, b, C.data(), blockSize,
+            i0, std::min(i0 + tileRows, blockSize), modulus);
+    }
+}
+
+// Compressed form of a block for the sparse shifts, where "zero" is the
+// semiring's zero:
+//   [0]                                             all zeros
+//   [nnz, rowStart (b + 1), cols (nnz), values (nnz)]  CSR
+//   [-1, b * b values]                              dense
+// CSR is used when nnz <= sparseLimit and it is the shorter of the two
+static void packBlock(const int* block, int blockSize, int sparseLimit,
+    int zero, std::vector<int>& packed)
+{
+    int nonZeros = 0;
+    for (int i = 0; i < blockSize * blockSize; ++i)
+        nonZeros += block[i] != zero;
+    bool csr = nonZeros <= sparseLimit
+        && 2 + blockSize + 2 * nonZeros <= 1 + blockSize * blockSize;
+    if (!csr)
+    {
+        packed[0] = -1;
+        std::copy(block, block + blockSize * blockSize, packed.begin() + 1);
+        return;
+    }
+    packed[0] = nonZeros;
+    if (nonZeros == 0)
+        return;
+    int* rowStart = &packed[1];
+    int* cols = rowStart + blockSize + 1;
+    int* values = cols + nonZeros;
+    int e = 0;
+    for (int i = 0; i < blockSize; ++i)
+    {
+        rowStart[i] = e;
+        for (int j = 0; j < blockSize; ++j)
+        {
+            if (block[i * blockSize + j] != zero)
+            {
+                cols[e] = j;
+                values[e++] = block[i * blockSize + j];
+            }
+        }
+    }
+    rowStart[blockSize] = e;
+}
+
+// Ints of packed that are in use
+static int packedLength(const std::vector<int>& packed, int blockSize)
+{
+    if (packed[0] < 0)
+        return 1 + blockSize * blockSize;
+    return packed[0] == 0 ? 1 : 2 + blockSize + 2 * packed[0];
+}
+
+// Expand a packed block back into a flat blockSize x blockSize block
+static void unpackBlock(const std::vector<int>& packed, int blockSize,
+    int zero, int* block)
+{
+    if (packed[0] < 0)
+    {
+        std::copy(packed.begin() + 1,
+            packed.begin() + 1 + blockSize * blockSize, block);
+        return;
+    }
+    std::fill(block, block + blockSize * blockSize, zero);
+    const int* rowStart = packed.data() + 1;
+    const int* cols = rowStart + blockSize + 1;
+    const int* values = cols + packed[0];
+    for (int i = 0; packed[0] > 0 && i < blockSize; ++i)
+        for (int e = rowStart[i]; e < rowStart[i + 1]; ++e)
+            block[i * blockSize + cols[e]] = values[e];
+}
+
+// Bit-packed form of a block of count entries for the compressed shifts:
+//   [bits, low, bitstream]   each entry as entry - low in bits bits,
+//                            packed LSB first across 32-bit words
+//   [-1, raw block bytes]    when packing does not pay
+// bits covers the block's range, so small ints (0..19 take 5 bits) and
+// near-constant blocks shrink most. Packing pays when the bytes it saves
+// take longer to send at bytesPerSecond than unpacking the block takes
+// at unpackSeconds per entry.
+template <typename T>
+static void compressBlock(const T* block, int count, double bytesPerSecond,
+    double unpackSeconds, std::vector<int>& packed)
+{
+    int64_t low = block[0], high = block[0];
+    for (int i = 1; i < count; ++i)
+    {
+        low = std::min<int64_t>(low, block[i]);
+        high = std::max<int64_t>(high, block[i]);
+    }
+    int bits = 0;
+    while (bits < 32 && (uint64_t(high - low) >> bits) != 0)
+        ++bits;
+    size_t rawInts = 1 + (count * sizeof(T) + 3) / 4;
+    size_t packedInts = 2 + (size_t(count) * bits + 31) / 32;
+    if (packedInts >= rawInts
+        || double(rawInts - packedInts) * 4 / bytesPerSecond <= count * unpackSeconds)
+    {
+        packed[0] = -1;
+        std::memcpy(&packed[1], block, count * sizeof(T));
+        return;
+    }
+    packed[0] = bits;
+    packed[1] = int(low);
+    uint32_t* words = reinterpret_cast<uint32_t*>(&packed[2]);
+    uint64_t pending = 0;
+    int pendingBits = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        pending |= uint64_t(uint32_t(block[i] - low)) << pendingBits;
+        pendingBits += bits;
+        if (pendingBits >= 32)
+        {
+            *words++ = uint32_t(pending);
+            pending >>= 32;
+            pendingBits -= 32;
+        }
+    }
+    if (pendingBits > 0)
+        *words = uint32_t(pending);
+}
+
+// Inverse of compressBlock
+template <typename T>
+static void expandBlock(const std::vector<int>& packed, T* block, int count)
+{
+    if (packed[0] < 0)
+    {
+        std::memcpy(block, &packed[1], count * sizeof(T));
+        return;
+    }
+    int bits = packed[0];
+    int64_t low = packed[1];
+    uint64_t mask = (uint64_t(1) << bits) - 1;
+    const uint32_t* words = reinterpret_cast<const uint32_t*>(&packed[2]);
+    uint64_t pending = 0;
+    int pendingBits = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        if (pendingBits < bits)
+        {
+            pending |= uint64_t(*words++) << pendingBits;
+            pendingBits += 32;
+        }
+        block[i] = T(low + int64_t(pending & mask));
+        pending >>= bits;
+        pendingBits -= bits;
+    }
+}
+
+// Ints of a compressBlock form that are in use
+static int compressedLength(const std::vector<int>& packed, int count,
+    int elementBytes)
+{
+    if (packed[0] < 0)
+        return 1 + (count * elementBytes + 3) / 4;
+    return 2 + int((size_t(count) * packed[0] + 31) / 32);
+}
+
+// Grid position (row * q + col) for every rank of comm, so that ranks
+// sharing a node get neighbouring positions. Nodes are the shared-memory
+// islands of MPI_Comm_split_type, named by their lowest rank. When every
+// node holds k ranks and some r x c = k tiles the q x q grid, each node
+// gets one such tile, the one with the shortest edge (r + c), so both
+// its row (A shift) and its column (B shift) neighbours are mostly on
+// the node. Otherwise nodes fill the grid row by row. Collective.
+static std::vector<int> nodeAwarePositions(MPI_Comm comm, int q)
+{
+    int P, rank;
+    MPI_Comm_size(comm, &P);
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm node;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node);
+    int leader = rank;
+    MPI_Bcast(&leader, 1, MPI_INT, 0, node);
+    MPI_Comm_free(&node);
+    std::vector<int> nodeOf(P);
+    MPI_Allgather(&leader, 1, MPI_INT, nodeOf.data(), 1, MPI_INT, comm);
+
+    // ranks node by node, in rank order within a node
+    std::vector<int> byNode(P);
+    std::iota(byNode.begin(), byNode.end(), 0);
+    std::stable_sort(byNode.begin(), byNode.end(),
+        [&](int x, int y) { return nodeOf[x] < nodeOf[y]; });
+    std::map<int, int> nodeSizes;
+    for (int leader : nodeOf)
+        ++nodeSizes[leader];
+    int k = nodeSizes.begin()->second;
+    bool even = true;
+    for (const auto& size : nodeSizes)
+        even = even && size.second == k;
+    int tileRows = 0, tileCols = 0;
+    for (int c = 1; even && c <= k; ++c)
+    {
+        int r = k / c;
+        if (r * c != k || q % r != 0 || q % c != 0)
+            continue;
+        if (tileRows == 0 || r + c <= tileRows + tileCols)
+        {
+            tileRows = r;
+            tileCols = c;
+        }
+    }
+
+    std::vector<int> position(P);
+    for (int i = 0; i < P; ++i)
+    {
+        if (tileRows == 0)
+        {
+            position[byNode[i]] = i;
+            continue;
+        }
+        int tile = i / k, inTile = i % k;
+        int tilesPerRow = q / tileCols;
+        int row = (tile / tilesPerRow) * tileRows + inTile / tileCols;
+        int col = (tile % tilesPerRow) * tileCols + inTile % tileCols;
+        position[byNode[i]] = row * q + col;
+    }
+    return position;
+}
+
+// A checkpoint file is a header of CheckpointField values followed by
+// the A, B and C blocks as they are in memory. Job and batch say whose
+// checkpoint it is: the job's token (see checkpointJob) and the batch's
+// place among this process's checkpointing batches
+enum CheckpointField
+{
+    CheckpointMagic, CheckpointJob, CheckpointBatch, CheckpointN,
+    CheckpointQ, CheckpointBlockSize, CheckpointPrecision,
+    CheckpointElementBytes, CheckpointRow, CheckpointCol, CheckpointRun,
+    CheckpointStep, CheckpointOverflowed, CheckpointFields
+};
+static const int64_t checkpointMagic = 0x43616e6e6f6e4350;   // "CannonCP"
+
+// The job this process checkpoints for, 0 until its first checkpointing
+// batch settles it, how many such batches it has built and how many of
+// them are alive. A fresh job draws a new token, so files of any earlier
+// job never match; a restart takes the token the crashed job left in
+// each rank's .job file. The file is there while a checkpointing batch
+// is alive and goes with the last one's checkpoints
+static int64_t checkpointJob = 0;
+static int     checkpointBatches = 0;
+static int     liveCheckpointBatches = 0;
+
+// Write data to path. It goes to a temporary name first and is renamed,
+// so a file under path is always whole; a write that fails leaves the
+// file as it was and returns false
+static bool writeCheckpoint(const std::string& path, const std::vector<char>& data)
+{
+    std::string partial = path + ".partial";
+    FILE* file = std::fopen(partial.c_str(), "wb");
+    if (!file)
+        return false;
+    bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    written = std::fclose(file) == 0 && written;
+    if (written && std::rename(partial.c_str(), path.c_str()) == 0)
+        return true;
+    std::remove(partial.c_str());
+    return false;
+}
+
+// Record the job's token in the .job file at path
+static void recordJob(const std::string& path)
+{
+    std::vector<char> data(sizeof checkpointJob);
+    std::memcpy(data.data(), &checkpointJob, sizeof checkpointJob);
+    writeCheckpoint(path, data);
+}
+
+// The contents of the file at path, empty if there is none
+static std::vector<char> readCheckpoint(const std::string& path)
+{
+    std::vector<char> data;
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return data;
+    char chunk[1 << 16];
+    size_t got;
+    while ((got = std::fread(chunk, 1, sizeof chunk, file)) > 0)
+        data.insert(data.end(), chunk, chunk + got);
+    std::fclose(file);
+    return data;
+}
+
+// The fault MpiBatches built from now on inject (see detail::injectFault)
+static detail::InjectedFault injectedFault;
+
+namespace detail {
+
+void injectFault(const InjectedFault& fault)
+{
+    injectedFault = fault;
+}
+
+const char* optionsError(const MpiOptions& options)
+{
+    bool dense = options.sparseDensity <= 0;
+    bool plain = options.semiring == Semiring::PlusTimes;
+    bool wide = options.precision == Precision::Int32;
+    if ((!dense || !plain) && !wide)
+        return "sparseDensity and semirings need Precision::Int32";
+    if (!dense && options.compressBytesPerSecond > 0)
+        return "sparseDensity and compressBytesPerSecond do not mix";
+    if (options.modulus != 0
+        && (options.modulus < 2 || !plain || !wide || !dense))
+        return "modulus must be at least 2, with PlusTimes, Int32 and no sparseDensity";
+    if (options.checkpointEvery < 0 || (options.checkpointEvery > 0
+        && (!dense || options.compressBytesPerSecond > 0)))
+        return "checkpointEvery must not be negative, nor set with sparseDensity or compressBytesPerSecond";
+    if (options.abft && (!plain || !wide || options.modulus != 0 || !dense
+        || options.compressBytesPerSecond > 0))
+        return "abft needs PlusTimes and Int32, without modulus, sparseDensity or compressBytesPerSecond";
+    return nullptr;
+}
+
+} // namespace detail
+
+MpiBatch::MpiBatch(int matrixSize, MPI_Comm comm, const MpiOptions& options)
+    : tiling(options.tiling), precision(options.precision),
+      sparseDensity(options.sparseDensity),
+      compressBytesPerSecond(options.compressBytesPerSecond),
+      unpackSeconds(0), semiring(options.semiring),
+      fault(injectedFault), root(options.root), n(matrixSize),
+      batchIndex(0), checkpointsWritten(0), checkpointFailures(0),
+      lastWriteFailed(false), stopped(false), runs(0), resumeRun(-1),
+      resumeStep(0)
+{
+    int P;
+    MPI_Comm_size(comm, &P);
+    MPI_Comm_rank(comm, &rank);
+
+    // 1) Must have P = q*q
+    q = (int)std::sqrt(P);
+    if (q * q != P)
+        throw invalid_argument("cannon::MpiBatch: number of processes must be a perfect square");
+
+    // 2) Build a 2D Cartesian communicator, periodic in both dims.
+    //    Rank r of comm2d sits at (r / q, r % q): we place the ranks
+    //    ourselves (on request by node) rather than leave it to the MPI
+    //    library's reorder flag, which many ignore. Root and the other
+    //    ranks are then known by their comm2d ranks
+    int nodeAware = options.nodeAware;
+    MPI_Bcast(&nodeAware, 1, MPI_INT, options.root, comm);
+    MPI_Comm ordered = comm;
+    if (nodeAware)
+    {
+        std::vector<int> position = nodeAwarePositions(comm, q);
+        MPI_Comm_split(comm, 0, position[rank], &ordered);
+    }
+    int dims[2] = {q, q};
+    int periods[2] = {1, 1}; // wraparound
+    MPI_Cart_create(ordered, 2, dims, periods, 0, &comm2d);
+    if (ordered != comm)
+        MPI_Comm_free(&ordered);
+    MPI_Comm_rank(comm2d, &rank);
+    MPI_Group commGroup, gridGroup;
+    MPI_Comm_group(comm, &commGroup);
+    MPI_Comm_group(comm2d, &gridGroup);
+    MPI_Group_translate_ranks(commGroup, 1, &options.root, gridGroup, &root);
+    std::vector<int> gridRanks(P);
+    std::iota(gridRanks.begin(), gridRanks.end(), 0);
+    owners.resize(P);
+    MPI_Group_translate_ranks(gridGroup, P, gridRanks.data(), commGroup, owners.data());
+    MPI_Group_free(&commGroup);
+    MPI_Group_free(&gridGroup);
+
+    // Get my coords in the grid
+    int coords[2];
+    MPI_Cart_coords(comm2d, rank, 2, coords);
+    myRow = coords[0];
+    myCol = coords[1];
+
+    // 3) Root knows n, the precision, the sparse density, the semiring,
+    //    the modulus, whether to check for overflow, the checkpoint
+    //    settings and whether to keep checksums, broadcasts to all
+    MPI_Bcast(&n, 1, MPI_INT, root, comm2d);
+    int codes[7] = { int(precision), int(semiring), options.modulus,
+        int(options.checkOverflow), options.checkpointEvery,
+        int(options.restart), int(options.abft) };
+    MPI_Bcast(codes, 7, MPI_INT, root, comm2d);
+    precision = Precision(codes[0]);
+    semiring = Semiring(codes[1]);
+    checkOverflow = codes[3] != 0;
+    checkpointEvery = codes[4];
+    abft = codes[6] != 0;
+    corrupted = false;
+    corrected = 0;
+    wideSums = false;
+    overflowed = false;
+    zero = semiringZero(semiring);
+    double rates[2] = { sparseDensity, compressBytesPerSecond };
+    MPI_Bcast(rates, 2, MPI_DOUBLE, root, comm2d);
+    sparseDensity = rates[0];
+    compressBytesPerSecond = rates[1];
+    modulus = codes[2];
+    MpiOptions taken;
+    taken.precision = precision;
+    taken.semiring = semiring;
+    taken.modulus = modulus;
+    taken.sparseDensity = sparseDensity;
+    taken.compressBytesPerSecond = compressBytesPerSecond;
+    taken.checkpointEvery = checkpointEvery;
+    taken.abft = abft;
+    if (const char* error = detail::optionsError(taken))
+    {
+        MPI_Comm_free(&comm2d);
+        throw invalid_argument(std::string("cannon::MpiBatch: ") + error);
+    }
+    switch (precision)
+    {
+    case Precision::Int16:
+        elementType = MPI_INT16_T;
+        elementBytes = sizeof(int16_t);
+        break;
+    case Precision::Int8:
+        elementType = MPI_INT8_T;
+        elementBytes = sizeof(int8_t);
+        break;
+    default:
+        elementType = MPI_INT;
+        elementBytes = sizeof(int);
+        break;
+    }
+
+    // 4) Compute blockSize and padded size
+    blockSize = (n + q - 1) / q; // = ceil(n / q)
+    nPadded = q * blockSize;     // padded dimension
+    // with ABFT the checksums of A and B follow their blocks
+    operandCount = blockSize * blockSize + (abft ? blockSize : 0);
+    if (!options.tuningFile.empty()
+        && tiling.rows == 0 && tiling.inner == 0 && tiling.cols == 0)
+        loadKernelTiling(options.tuningFile, blockSize, tiling);
+
+    // 5) Root's staging buffers are block arenas in grid order, so every
+    //    rank's block is one contiguous run. The padding is never
+    //    written, so it keeps the semiring's zero for every product
+    for (int slot = 0; slot < 2; ++slot)
+    {
+        if (rank == root)
+        {
+            paddedA[slot].assign(nPadded * nPadded * elementBytes, 0);
+            paddedB[slot].assign(nPadded * nPadded * elementBytes, 0);
+            if (zero != 0)
+            {
+                int* a = reinterpret_cast<int*>(paddedA[slot].data());
+                int* b = reinterpret_cast<int*>(paddedB[slot].data());
+                std::fill(a, a + nPadded * nPadded, zero);
+                std::fill(b, b + nPadded * nPadded, zero);
+            }
+        }
+        // 6) Local blocks and result block
+        Ablock[slot].resize(operandCount * elementBytes);
+        Bblock[slot].resize(operandCount * elementBytes);
+        Cblock[slot].resize(blockSize * blockSize);
+    }
+    if (abft)
+    {
+        checkC.resize(2 * blockSize);
+        sumsC.resize(2 * blockSize);
+    }
+    if (sparseDensity > 0)
+    {
+        packedA.resize(1 + blockSize * blockSize);
+        packedB.resize(1 + blockSize * blockSize);
+        packedRecv.resize(1 + blockSize * blockSize);
+        expandedB.resize(blockSize * blockSize);
+    }
+    if (compressBytesPerSecond > 0)
+    {
+        // a packed form is never longer than the raw one
+        int count = blockSize * blockSize;
+        int longest = 1 + (count * elementBytes + 3) / 4;
+        packedA.resize(longest);
+        packedB.resize(longest);
+        packedRecv.resize(longest);
+        packedRecvB.resize(longest);
+
+        // Every compressed shift costs an unpack on the critical path;
+        // time one of a 5-bit block on this rank's CPU for the cost model
+        std::vector<int> sample(count), unpacked(count);
+        for (int i = 0; i < count; ++i)
+            sample[i] = i % 20;
+        if (count > 0)
+        {
+            compressBlock(sample.data(), count, 1.0, 0.0, packedRecv);
+            auto start = std::chrono::steady_clock::now();
+            expandBlock(packedRecv, unpacked.data(), count);
+            std::chrono::duration<double> took
+                = std::chrono::steady_clock::now() - start;
+            unpackSeconds = took.count() / count;
+        }
+    }
+
+    // 7) Create MPI datatypes for one block of the A/B arenas and for
+    //    the rows and columns of our C block that are not padding
+    MPI_Type_contiguous(blockSize * blockSize, elementType, &operandBlockType);
+    MPI_Type_commit(&operandBlockType);
+    int height = std::max(0, std::min(blockSize, n - myRow * blockSize));
+    int width = std::max(0, std::min(blockSize, n - myCol * blockSize));
+    MPI_Type_vector(height, width, blockSize, MPI_INT, &clippedBlockType);
+    MPI_Type_commit(&clippedBlockType);
+
+    // 8) Compute displacements (in blocks) for Scatterv
+    displs.assign(P, 0);
+    counts.assign(P, 1);
+    if (rank == root)
+    {
+        // rank i*q + j holds block (i, j), slot i*q + j of the arenas
+        std::iota(displs.begin(), displs.end(), 0);
+    }
+    // blocks wholly in the padding have nothing to send
+    sendsC = height > 0 && width > 0;
+
+    // Checkpoint files are named by the rank in MPI_COMM_WORLD, which
+    // stays unique however comm is split or the grid is placed, and by
+    // the batch
+    if (checkpointEvery > 0 || codes[5] != 0)
+    {
+        int worldRank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+        std::string prefix = (options.checkpointDir.empty() ? std::string(".")
+            : options.checkpointDir) + "/cannon-" + std::to_string(worldRank);
+        jobPath = prefix + ".job";
+        if (checkpointJob == 0)
+            startJob(codes[5] != 0);
+        else if (liveCheckpointBatches == 0)
+            recordJob(jobPath);
+        ++liveCheckpointBatches;
+        MPI_Bcast(&checkpointBatches, 1, MPI_INT, root, comm2d);
+        batchIndex = checkpointBatches++;
+        checkpointPath = prefix + "-" + std::to_string(batchIndex) + ".";
+        if (codes[5] != 0)
+            findCheckpoint();
+        if (resumeRun < 0)
+            removeCheckpoints();
+    }
+}
+
+MpiBatch::~MpiBatch()
+{
+    // the batch is done, so are its checkpoints, and with the last
+    // batch alive the job's record. A stopped batch leaves them all
+    // behind as a crash would, and the process forgets the job
+    if (checkpointWriter.joinable())
+        checkpointWriter.join();
+    if (!checkpointPath.empty() && stopped)
+    {
+        checkpointJob = 0;
+        checkpointBatches = 0;
+        liveCheckpointBatches = 0;
+    }
+    else if (!checkpointPath.empty())
+    {
+        removeCheckpoints();
+        if (--liveCheckpointBatches == 0)
+            std::remove(jobPath.c_str());
+    }
+    MPI_Type_free(&operandBlockType);
+    MPI_Type_free(&clippedBlockType);
+    MPI_Comm_free(&comm2d);
+}
+
+// Root copies one (A, B) pair into the staging arenas of a slot
+void MpiBatch::pack(ConstMatrixView A, ConstMatrixView B, int slot)
+{
+    switch (precision)
+    {
+    case Precision::Int16:
+        toBlocks(A, reinterpret_cast<int16_t*>(paddedA[slot].data()), q, blockSize);
+        toBlocks(B, reinterpret_cast<int16_t*>(paddedB[slot].data()), q, blockSize);
+        break;
+    case Precision::Int8:
+        toBlocks(A, reinterpret_cast<int8_t*>(paddedA[slot].data()), q, blockSize);
+        toBlocks(B, reinterpret_cast<int8_t*>(paddedB[slot].data()), q, blockSize);
+        break;
+    default:
+        toBlocks(A, reinterpret_cast<int*>(paddedA[slot].data()), q, blockSize);
+        toBlocks(B, reinterpret_cast<int*>(paddedB[slot].data()), q, blockSize);
+        break;
+    }
+}
+
+// 12) Start gathering every rank's C block (block, from one of the
+//     slot's buffers) into root's view C. Root receives rank (i, j)'s
+//     block through a datatype that picks out the rows and columns of C
+//     it covers, so nothing lands in the padding and no trim is needed.
+//     Per-rank datatypes rule out MPI_Gatherv, hence one message each
+void MpiBatch::startGather(int slot, const int* block, MatrixView C)
+{
+    std::vector<MPI_Request>& requests = gatherRequests[slot];
+    requests.clear();
+    if (rank == root)
+    {
+        for (int r = 0; r < q * q; ++r)
+        {
+            // rank i*q + j holds block (i, j)
+            int rowBegin = (r / q) * blockSize;
+            int colBegin = (r % q) * blockSize;
+            int height = std::min(blockSize, n - rowBegin);
+            int width = std::min(blockSize, n - colBegin);
+            if (height <= 0 || width <= 0)
+                continue;
+            MPI_Datatype place;
+            MPI_Type_vector(height, width, C.stride, MPI_INT, &place);
+            MPI_Type_commit(&place);
+            requests.emplace_back();
+            MPI_Irecv(&C(rowBegin, colBegin), 1, place, r, 1, comm2d,
+                &requests.back());
+            MPI_Type_free(&place);
+        }
+    }
+    // tag 1, so it cannot match the shifts of the next product
+    if (sendsC)
+    {
+        requests.emplace_back();
+        MPI_Isend(block, 1, clippedBlockType, root, 1, comm2d,
+            &requests.back());
+    }
+}
+
+// Wait for a slot's gather to land in root's C
+void MpiBatch::finishGather(int slot)
+{
+    std::vector<MPI_Request>& requests = gatherRequests[slot];
+    MPI_Waitall(int(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    requests.clear();
+}
+
+// Move one operand block from src to dst (and ours from src): the block
+// itself in place with its checksums if any, or with sparse shifts its
+// compressed form
+void MpiBatch::shiftOperand(std::vector<char>& block, std::vector<int>& packed,
+    int src, int dst)
+{
+    MPI_Status status;
+    if (sparseDensity > 0 || compressBytesPerSecond > 0)
+    {
+        int length = sparseDensity > 0 ? packedLength(packed, blockSize)
+            : compressedLength(packed, blockSize * blockSize, elementBytes);
+        MPI_Sendrecv(
+            packed.data(), length, MPI_INT, dst, 0,
+            packedRecv.data(), int(packedRecv.size()), MPI_INT, src, 0,
+            comm2d, &status);
+        packed.swap(packedRecv);
+        return;
+    }
+    MPI_Sendrecv_replace(
+        block.data(), operandCount, elementType,
+        dst, 0, src, 0, comm2d, &status);
+}
+
+// Local C += A x B on the blocks of one slot (or their compressed forms)
+void MpiBatch::multiplyLocal(int slot)
+{
+    if (modulus != 0)
+    {
+        multiplyBlocksMod(reinterpret_cast<const int*>(Ablock[slot].data()),
+            reinterpret_cast<const int*>(Bblock[slot].data()), Cblock[slot],
+            blockSize, tiling, Modulus(modulus));
+        return;
+    }
+    if (wideSums)
+    {
+        if (sparseDensity > 0)
+        {
+            // only the packed forms travel: nothing to add when a side
+            // is all zeros, otherwise both are expanded for the kernel
+            if (packedA[0] == 0 || packedB[0] == 0)
+                return;
+            unpackBlock(packedA, blockSize, zero,
+                reinterpret_cast<int*>(Ablock[slot].data()));
+            unpackBlock(packedB, blockSize, zero,
+                reinterpret_cast<int*>(Bblock[slot].data()));
+        }
+        const char* A = Ablock[slot].data();
+        const char* B = Bblock[slot].data();
+        std::vector<int>& C = Cblock[slot];
+        bool stepOverflowed;
+        if (precision == Precision::Int16)
+            stepOverflowed = multiplyBlocksWide(reinterpret_cast<const int16_t*>(A),
+                reinterpret_cast<const int16_t*>(B), C, blockSize, tiling);
+        else if (precision == Precision::Int8)
+            stepOverflowed = multiplyBlocksWide(reinterpret_cast<const int8_t*>(A),
+                reinterpret_cast<const int8_t*>(B), C, blockSize, tiling);
+        else
+            stepOverflowed = multiplyBlocksWide(reinterpret_cast<const int*>(A),
+                reinterpret_cast<const int*>(B), C, blockSize, tiling);
+        overflowed = overflowed || stepOverflowed;
+        return;
+    }
+    switch (semiring)
+    {
+    case Semiring::PlusTimes: multiplyLocalAs<PlusTimes>(slot); break;
+    case Semiring::MinPlus:   multiplyLocalAs<MinPlus>(slot); break;
+    case Semiring::MaxPlus:   multiplyLocalAs<MaxPlus>(slot); break;
+    case Semiring::BoolOrAnd: multiplyLocalAs<BoolOrAnd>(slot); break;
+    }
+}
+
+template <typename S>
+void MpiBatch::multiplyLocalAs(int slot)
+{
+    std::vector<int>& C = Cblock[slot];
+    if (sparseDensity <= 0)
+    {
+        const char* A = Ablock[slot].data();
+        const char* B = Bblock[slot].data();
+        if (precision == Precision::Int16)
+            multiplyBlocks<PlusTimes>(reinterpret_cast<const int16_t*>(A),
+                reinterpret_cast<const int16_t*>(B), C, blockSize, tiling);
+        else if (precision == Precision::Int8)
+            multiplyBlocks<PlusTimes>(reinterpret_cast<const int8_t*>(A),
+                reinterpret_cast<const int8_t*>(B), C, blockSize, tiling);
+        else
+            multiplyBlocks<S>(reinterpret_cast<const int*>(A),
+                reinterpret_cast<const int*>(B), C, blockSize, tiling);
+        return;
+    }
+
+    // nothing to add when either side is all zeros
+    if (packedA[0] == 0 || packedB[0] == 0)
+        return;
+    const int* B = packedB.data() + 1;
+    if (packedB[0] > 0)
+    {
+        unpackBlock(packedB, blockSize, zero, expandedB.data());
+        B = expandedB.data();
+    }
+    if (packedA[0] < 0)
+    {
+        multiplyBlocks<S>(packedA.data() + 1, B, C, blockSize, tiling);
+        return;
+    }
+    const int* rowStart = packedA.data() + 1;
+    const int* cols = rowStart + blockSize + 1;
+    const int* values = cols + packedA[0];
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < blockSize; ++i)
+    {
+        multiplyAccCsr<S>(rowStart, cols, values, B, C.data(),
+            blockSize, i, i + 1);
+    }
+}
+
+// Skew and the q Cannon steps on the blocks of one slot
+void MpiBatch::cannonSteps(int slot)
+{
+    std::vector<char>& A = Ablock[slot];
+    std::vector<char>& B = Bblock[slot];
+    int src, dst;
+    long long run = runs++;
+    int firstStep = 0;
+    if (run == resumeRun)
+    {
+        // a restarted run: the blocks are already skewed and partly
+        // multiplied
+        resume(slot);
+        firstStep = resumeStep;
+        resumeRun = -1;
+    }
+    else
+    {
+        std::fill(Cblock[slot].begin(), Cblock[slot].end(), zero);
+        overflowed = false;
+        corrupted = false;
+        if (abft)
+        {
+            // the checksums go through the skew with their blocks
+            addChecksums(slot);
+            std::fill(checkC.begin(), checkC.end(), 0u);
+        }
+        if (sparseDensity > 0)
+        {
+            int sparseLimit = int(sparseDensity * blockSize * blockSize);
+            packBlock(reinterpret_cast<const int*>(A.data()), blockSize,
+                sparseLimit, zero, packedA);
+            packBlock(reinterpret_cast<const int*>(B.data()), blockSize,
+                sparseLimit, zero, packedB);
+        }
+        if (compressBytesPerSecond > 0)
+            compressOperands(slot);
+
+        // 10) Initial alignment ("skew")
+        // 10a) Shift A left by myRow steps
+        MPI_Cart_shift(comm2d, 1, -1, &src, &dst);
+        for (int i = 0; i < myRow; ++i)
+        {
+            shiftOperand(A, packedA, src, dst);
+        }
+        // 10b) Shift B up by myCol steps
+        MPI_Cart_shift(comm2d, 0, -1, &src, &dst);
+        for (int i = 0; i < myCol; ++i)
+        {
+            shiftOperand(B, packedB, src, dst);
+        }
+        if (compressBytesPerSecond > 0)
+        {
+            compressedSteps(slot);
+            return;
+        }
+    }
+
+    // With ABFT the operands are checked before the first multiply too,
+    // as they arrive from the skew (or a checkpoint)
+    if (abft)
+        checkOperands(slot);
+
+    // 11) The main Cannon loop. Runs before the one a restart picks up
+    //     save nothing: their files would overwrite its checkpoint
+    bool saving = checkpointEvery > 0 && resumeRun < 0;
+    for (int step = firstStep; step < q; ++step)
+    {
+        // 11a) Local multiply-accumulate; with ABFT the checksums too,
+        //      then put C right
+        multiplyLocal(slot);
+        if (faultAt(detail::InjectedFault::CEntry, step))
+            Cblock[slot][0] ^= 1;
+        if (abft)
+        {
+            updateChecksums(slot);
+            if (faultAt(detail::InjectedFault::RowChecksum, step))
+                checkC[0] ^= 1;
+            if (faultAt(detail::InjectedFault::ColumnChecksum, step))
+                checkC[blockSize] ^= 1;
+            correctBlock(slot);
+        }
+        // 11b) Shift A one step left
+        MPI_Cart_shift(comm2d, 1, -1, &src, &dst);
+        shiftOperand(A, packedA, src, dst);
+        // 11c) Shift B one step up
+        MPI_Cart_shift(comm2d, 0, -1, &src, &dst);
+        shiftOperand(B, packedB, src, dst);
+        if (faultAt(detail::InjectedFault::AEntry, step))
+            A[0] ^= 1;
+        if (abft && step + 1 < q)
+            checkOperands(slot);
+        // 11d) Every checkpointEvery steps, save the state the next step
+        //      starts from
+        if (saving && (step + 1) % checkpointEvery == 0 && step + 1 < q)
+            checkpoint(slot, run, step + 1);
+        if (fault.kind == detail::InjectedFault::Stop && fault.step == step)
+        {
+            stopped = true;
+            throw runtime_error("cannon::MpiBatch: stopped by an injected fault");
+        }
+    }
+}
+
+// Whether the injected fault is of kind and hits this rank at step
+bool MpiBatch::faultAt(detail::InjectedFault::Kind kind, int step) const
+{
+    return fault.kind == kind && fault.step == step && owners[rank] == fault.rank;
+}
+
+// Settle the job this process checkpoints for. On restart the ranks take
+// the token in their .job files if they all hold the same one; otherwise
+// root draws a new one, which every rank records there
+void MpiBatch::startJob(bool restarting)
+{
+    int64_t token = 0;
+    if (restarting)
+    {
+        std::vector<char> data = readCheckpoint(jobPath);
+        if (data.size() == sizeof token)
+            std::memcpy(&token, data.data(), sizeof token);
+    }
+    int64_t lowest, highest;
+    MPI_Allreduce(&token, &lowest, 1, MPI_INT64_T, MPI_MIN, comm2d);
+    MPI_Allreduce(&token, &highest, 1, MPI_INT64_T, MPI_MAX, comm2d);
+    bool drawn = lowest == 0 || lowest != highest;
+    if (drawn)
+    {
+        if (rank == root)
+        {
+            std::random_device device;
+            token = (int64_t(device()) << 32 | device())
+                ^ std::chrono::steady_clock::now().time_since_epoch().count();
+            if (token == 0)
+                token = 1;
+        }
+        MPI_Bcast(&token, 1, MPI_INT64_T, root, comm2d);
+    }
+    checkpointJob = token;
+    if (drawn)
+        recordJob(jobPath);
+}
+
+// Delete both checkpoint files of this batch, if there are any
+void MpiBatch::removeCheckpoints()
+{
+    for (int f = 0; f < 2; ++f)
+        std::remove((checkpointPath + std::to_string(f)).c_str());
+}
+
+// Save the blocks of one slot, ready for step of run. They are copied
+// here and written on a background thread. The previous checkpoint must
+// first be whole on every rank: then the file before it, which this one
+// replaces, is no longer needed. If any rank could not write the previous
+// one, every rank writes this one over it instead, keeping the file
+// before it, so the ranks still alternate in step
+void MpiBatch::checkpoint(int slot, long long run, int step)
+{
+    if (checkpointWriter.joinable())
+        checkpointWriter.join();
+    int failed = lastWriteFailed, anyFailed;
+    MPI_Allreduce(&failed, &anyFailed, 1, MPI_INT, MPI_MAX, comm2d);
+    if (anyFailed)
+    {
+        ++checkpointFailures;
+        --checkpointsWritten;
+    }
+
+    size_t operandBytes = Ablock[slot].size();
+    size_t header = CheckpointFields * sizeof(int64_t);
+    std::vector<char> data(header + 2 * operandBytes
+        + Cblock[slot].size() * sizeof(int));
+    int64_t fields[CheckpointFields];
+    fields[CheckpointMagic] = checkpointMagic;
+    fields[CheckpointJob] = checkpointJob;
+    fields[CheckpointBatch] = batchIndex;
+    fields[CheckpointN] = n;
+    fields[CheckpointQ] = q;
+    fields[CheckpointBlockSize] = blockSize;
+    fields[CheckpointPrecision] = int(precision);
+    fields[CheckpointElementBytes] = elementBytes;
+    fields[CheckpointRow] = myRow;
+    fields[CheckpointCol] = myCol;
+    fields[CheckpointRun] = run;
+    fields[CheckpointStep] = step;
+    fields[CheckpointOverflowed] = overflowed;
+    char* to = data.data();
+    std::memcpy(to, fields, header);
+    std::memcpy(to + header, Ablock[slot].data(), operandBytes);
+    std::memcpy(to + header + operandBytes, Bblock[slot].data(), operandBytes);
+    std::memcpy(to + header + 2 * operandBytes, Cblock[slot].data(),
+        Cblock[slot].size() * sizeof(int));
+
+    std::string path = checkpointPath + std::to_string(checkpointsWritten++ % 2);
+    lastWriteFailed = false;
+    checkpointWriter = std::thread([this, path, data = std::move(data)]() {
+        lastWriteFailed = !writeCheckpoint(path, data);
+    });
+}
+
+// Restart: read both of this rank's files and agree with the others on
+// the newest checkpoint they all hold. A rank's newest may be one ahead
+// of the rest, but then its other file holds theirs (see checkpoint)
+void MpiBatch::findCheckpoint()
+{
+    size_t operandBytes = Ablock[0].size();
+    size_t header = CheckpointFields * sizeof(int64_t);
+    size_t length = header + 2 * operandBytes + Cblock[0].size() * sizeof(int);
+    std::vector<char> files[2];
+    long long found[2] = { -1, -1 };   // run * (q + 1) + step
+    for (int f = 0; f < 2; ++f)
+    {
+        files[f] = readCheckpoint(checkpointPath + std::to_string(f));
+        if (files[f].size() != length)
+            continue;
+        int64_t fields[CheckpointFields];
+        std::memcpy(fields, files[f].data(), header);
+        if (fields[CheckpointMagic] != checkpointMagic
+            || fields[CheckpointJob] != checkpointJob
+            || fields[CheckpointBatch] != batchIndex || fields[CheckpointN] != n
+            || fields[CheckpointQ] != q || fields[CheckpointBlockSize] != blockSize
+            || fields[CheckpointPrecision] != int(precision)
+            || fields[CheckpointElementBytes] != elementBytes
+            || fields[CheckpointRow] != myRow || fields[CheckpointCol] != myCol
+            || fields[CheckpointStep] < 1 || fields[CheckpointStep] >= q)
+            continue;
+        found[f] = fields[CheckpointRun] * (q + 1) + fields[CheckpointStep];
+    }
+    long long newest = std::max(found[0], found[1]), common;
+    MPI_Allreduce(&newest, &common, 1, MPI_LONG_LONG, MPI_MIN, comm2d);
+    int file = found[0] == common ? 0 : found[1] == common ? 1 : -1;
+    int everyone, held = common >= 0 && file >= 0;
+    MPI_Allreduce(&held, &everyone, 1, MPI_INT, MPI_MIN, comm2d);
+    if (!everyone)
+        return;
+    resumeRun = common / (q + 1);
+    resumeStep = int(common % (q + 1));
+    resumeData.swap(files[file]);
+    // the next checkpoint goes to the other file
+    checkpointsWritten = file + 1;
+}
+
+// Load the checkpoint found at construction into the blocks of one slot
+void MpiBatch::resume(int slot)
+{
+    size_t operandBytes = Ablock[slot].size();
+    size_t header = CheckpointFields * sizeof(int64_t);
+    int64_t fields[CheckpointFields];
+    const char* from = resumeData.data();
+    std::memcpy(fields, from, header);
+    std::memcpy(Ablock[slot].data(), from + header, operandBytes);
+    std::memcpy(Bblock[slot].data(), from + header + operandBytes, operandBytes);
+    std::memcpy(Cblock[slot].data(), from + header + 2 * operandBytes,
+        Cblock[slot].size() * sizeof(int));
+    overflowed = fields[CheckpointOverflowed] != 0;
+    std::vector<char>().swap(resumeData);
+    // C was checked before it was saved, so its sums are its checksums
+    corrupted = false;
+    if (abft)
+        sumBlock(Cblock[slot], checkC);
+}
+
+// ABFT. Sums are taken in unsigned ints: they wrap modulo 2^32 exactly
+// as the kernels' int sums do, so checksums stay exact whatever the
+// entries. Append to a slot's A block its column sums (the checksum row)
+// and to its B block its row sums (the checksum column)
+void MpiBatch::addChecksums(int slot)
+{
+    int count = blockSize * blockSize;
+    const int* A = reinterpret_cast<const int*>(Ablock[slot].data());
+    const int* B = reinterpret_cast<const int*>(Bblock[slot].data());
+    unsigned* sumsA = reinterpret_cast<unsigned*>(Ablock[slot].data()) + count;
+    unsigned* sumsB = reinterpret_cast<unsigned*>(Bblock[slot].data()) + count;
+    std::fill(sumsA, sumsA + blockSize, 0u);
+    for (int i = 0; i < blockSize; ++i)
+    {
+        unsigned rowSum = 0;
+        for (int j = 0; j < blockSize; ++j)
+        {
+            sumsA[j] += unsigned(A[i * blockSize + j]);
+            rowSum += unsigned(B[i * blockSize + j]);
+        }
+        sumsB[i] = rowSum;
+    }
+}
+
+// An A or B block that arrives not matching its checksums was corrupted
+// on the way; nothing says where, so the product is marked
+void MpiBatch::checkOperands(int slot)
+{
+    int count = blockSize * blockSize;
+    const int* A = reinterpret_cast<const int*>(Ablock[slot].data());
+    const int* B = reinterpret_cast<const int*>(Bblock[slot].data());
+    const unsigned* sumsA = reinterpret_cast<const unsigned*>(A + count);
+    const unsigned* sumsB = reinterpret_cast<const unsigned*>(B + count);
+    // sumsC is free between steps
+    std::vector<unsigned>& colSums = sumsC;
+    std::fill(colSums.begin(), colSums.begin() + blockSize, 0u);
+    for (int i = 0; i < blockSize; ++i)
+    {
+        unsigned rowSum = 0;
+        for (int j = 0; j < blockSize; ++j)
+        {
+            colSums[j] += unsigned(A[i * blockSize + j]);
+            rowSum += unsigned(B[i * blockSize + j]);
+        }
+        if (rowSum != sumsB[i])
+            corrupted = true;
+    }
+    for (int j = 0; j < blockSize; ++j)
+        if (colSums[j] != sumsA[j])
+            corrupted = true;
+}
+
+// Row sums of a C block into sums[0, b), column sums into sums[b, 2b)
+void MpiBatch::sumBlock(const std::vector<int>& C,
+    std::vector<unsigned>& sums) const
+{
+    std::fill(sums.begin(), sums.end(), 0u);
+    unsigned* colSums = sums.data() + blockSize;
+    for (int i = 0; i < blockSize; ++i)
+    {
+        unsigned rowSum = 0;
+        for (int j = 0; j < blockSize; ++j)
+        {
+            unsigned c = unsigned(C[i * blockSize + j]);
+            rowSum += c;
+            colSums[j] += c;
+        }
+        sums[i] = rowSum;
+    }
+}
+
+// What this step added to C, as sums: A times B's checksum column for
+// the rows, A's checksum row times B for the columns
+void MpiBatch::updateChecksums(int slot)
+{
+    int count = blockSize * blockSize;
+    const int* A = reinterpret_cast<const int*>(Ablock[slot].data());
+    const int* B = reinterpret_cast<const int*>(Bblock[slot].data());
+    const unsigned* sumsA = reinterpret_cast<const unsigned*>(A + count);
+    const unsigned* sumsB = reinterpret_cast<const unsigned*>(B + count);
+    unsigned* colChecks = checkC.data() + blockSize;
+    for (int i = 0; i < blockSize; ++i)
+    {
+        unsigned row = 0;
+        for (int k = 0; k < blockSize; ++k)
+            row += unsigned(A[i * blockSize + k]) * sumsB[k];
+        checkC[i] += row;
+        unsigned a = sumsA[i];
+        for (int j = 0; j < blockSize; ++j)
+            colChecks[j] += a * unsigned(B[i * blockSize + j]);
+    }
+}
+
+// Compare C's sums with its checksums. One row and one column off by the
+// same amount locate a single wrong entry, which is put right. Anything
+// else marks the product: a lone row or column off may be a hit
+// checksum, but also a wrong operand entry whose partner row or column
+// held a single non-zero, and the two cannot be told apart
+void MpiBatch::correctBlock(int slot)
+{
+    std::vector<int>& C = Cblock[slot];
+    sumBlock(C, sumsC);
+    int badRows = 0, badCols = 0, row = 0, col = 0;
+    for (int i = 0; i < blockSize; ++i)
+    {
+        if (sumsC[i] != checkC[i])
+        {
+            ++badRows;
+            row = i;
+        }
+        if (sumsC[blockSize + i] != checkC[blockSize + i])
+        {
+            ++badCols;
+            col = i;
+        }
+    }
+    if (badRows == 0 && badCols == 0)
+        return;
+    unsigned rowError = checkC[row] - sumsC[row];
+    unsigned colError = checkC[blockSize + col] - sumsC[blockSize + col];
+    if (badRows == 1 && badCols == 1 && rowError == colError)
+    {
+        C[row * blockSize + col] = int(unsigned(C[row * blockSize + col]) + rowError);
+        ++corrected;
+    }
+    else
+        corrupted = true;
+}
+
+// Compressed shifts: pack a slot's A and B blocks, once per product.
+// The packed forms are what travel from then on; a rank forwards what
+// it received without packing again
+void MpiBatch::compressOperands(int slot)
+{
+    int count = blockSize * blockSize;
+    const char* A = Ablock[slot].data();
+    const char* B = Bblock[slot].data();
+    switch (precision)
+    {
+    case Precision::Int16:
+        compressBlock(reinterpret_cast<const int16_t*>(A), count, compressBytesPerSecond, unpackSeconds, packedA);
+        compressBlock(reinterpret_cast<const int16_t*>(B), count, compressBytesPerSecond, unpackSeconds, packedB);
+        break;
+    case Precision::Int8:
+        compressBlock(reinterpret_cast<const int8_t*>(A), count, compressBytesPerSecond, unpackSeconds, packedA);
+        compressBlock(reinterpret_cast<const int8_t*>(B), count, compressBytesPerSecond, unpackSeconds, packedB);
+        break;
+    default:
+        compressBlock(reinterpret_cast<const int*>(A), count, compressBytesPerSecond, unpackSeconds, packedA);
+        compressBlock(reinterpret_cast<const int*>(B), count, compressBytesPerSecond, unpackSeconds, packedB);
+        break;
+    }
+}
+
+// Unpack a received compressed form into an operand block of a slot
+void MpiBatch::expandOperand(const std::vector<int>& packed,
+    std::vector<char>& block)
+{
+    int count = blockSize * blockSize;
+    switch (precision)
+    {
+    case Precision::Int16:
+        expandBlock(packed, reinterpret_cast<int16_t*>(block.data()), count);
+        break;
+    case Precision::Int8:
+        expandBlock(packed, reinterpret_cast<int8_t*>(block.data()), count);
+        break;
+    default:
+        expandBlock(packed, reinterpret_cast<int*>(block.data()), count);
+        break;
+    }
+}
+
+// 11) The main Cannon loop with compressed shifts. The packed forms of
+//     the blocks being multiplied are exactly what goes out next, so
+//     each step posts its exchange before the local multiply and the
+//     transfer overlaps it; only the unpack of what arrived is left
+//     after it. The shift after the last step is not needed and skipped.
+//     B travels with tag 2: tag 1 is the previous product's gather
+void MpiBatch::compressedSteps(int slot)
+{
+    int count = blockSize * blockSize;
+    int left, right, up, down;
+    MPI_Cart_shift(comm2d, 1, -1, &right, &left);
+    MPI_Cart_shift(comm2d, 0, -1, &down, &up);
+    expandOperand(packedA, Ablock[slot]);
+    expandOperand(packedB, Bblock[slot]);
+    for (int step = 0; step < q; ++step)
+    {
+        bool last = step + 1 == q;
+        MPI_Request requests[4];
+        if (!last)
+        {
+            MPI_Irecv(packedRecv.data(), int(packedRecv.size()), MPI_INT,
+                right, 0, comm2d, &requests[0]);
+            MPI_Irecv(packedRecvB.data(), int(packedRecvB.size()), MPI_INT,
+                down, 2, comm2d, &requests[1]);
+            MPI_Isend(packedA.data(), compressedLength(packedA, count, elementBytes),
+                MPI_INT, left, 0, comm2d, &requests[2]);
+            MPI_Isend(packedB.data(), compressedLength(packedB, count, elementBytes),
+                MPI_INT, up, 2, comm2d, &requests[3]);
+        }
+        // 11a) Local multiply-accumulate
+        multiplyLocal(slot);
+        if (last)
+            break;
+        // 11b) + 11c) A has moved one step left and B one step up
+        MPI_Waitall(4, requests, MPI_STATUSES_IGNORE);
+        packedA.swap(packedRecv);
+        packedB.swap(packedRecvB);
+        expandOperand(packedA, Ablock[slot]);
+        expandOperand(packedB, Bblock[slot]);
+    }
+}
+
+// 9) Scatter the blocks of one slot's A and B
+void MpiBatch::scatter(int slot, MPI_Request* requests)
+{
+    scatterOperand(paddedA[slot], Ablock[slot], &requests[0]);
+    scatterOperand(paddedB[slot], Bblock[slot], &requests[1]);
+}
+
+// Scatter one staging arena of root's into every rank's block
+void MpiBatch::scatterOperand(std::vector<char>& padded,
+    std::vector<char>& block, MPI_Request* request)
+{
+    MPI_Iscatterv(
+        padded.data(), counts.data(), displs.data(), operandBlockType,
+        block.data(), blockSize * blockSize, elementType,
+        root, comm2d, request);
+}
+
+// Root checks the shapes and entries of a list of products and works out
+// whether they need 64-bit sums; every rank learns the outcome, throws
+// what caller would for a bad list, and otherwise gets the count. C
+// views are only checked when the results are gathered
+int MpiBatch::checkProducts(const char* caller,
+    const std::vector<ConstMatrixView>& As,
+    const std::vector<ConstMatrixView>& Bs,
+    const std::vector<MatrixView>& Cs, bool gathered)
+{
+    // count, or -1/-2 for bad views, and whether to sum in 64 bits
+    int header[2] = { int(As.size()), 0 };
+    int& count = header[0];
+    if (rank == root)
+    {
+        bool shapesOk = Bs.size() == As.size()
+            && (!gathered || Cs.size() == As.size());
+        for (int i = 0; shapesOk && i < count; ++i)
+            shapesOk = As[i].rows == n && As[i].cols == n
+                && Bs[i].rows == n && Bs[i].cols == n
+                && (!gathered || (Cs[i].rows == n && Cs[i].cols == n));
+        bool valuesFit = true;
+        for (int i = 0; shapesOk && valuesFit && i < count; ++i)
+            valuesFit = fitsPrecision(As[i], precision)
+                && fitsPrecision(Bs[i], precision)
+                && fitsSemiring(As[i], semiring)
+                && fitsSemiring(Bs[i], semiring)
+                && (modulus == 0 || (fitsModulus(As[i], modulus)
+                    && fitsModulus(Bs[i], modulus)));
+        if (!shapesOk)
+            count = -1;
+        else if (!valuesFit)
+            count = -2;
+        for (int i = 0; count > 0 && i < count; ++i)
+            if (semiring == Semiring::PlusTimes && modulus == 0
+                && needsWideSums(As[i], Bs[i]))
+                header[1] = 1;
+    }
+    MPI_Bcast(header, 2, MPI_INT, root, comm2d);
+    wideSums = header[1] != 0;
+    if (count == -1)
+        throw invalid_argument(std::string(caller) + ": every product must be n x n");
+    if (count < 0)
+        throw invalid_argument(std::string(caller) + ": an entry of A or B does not fit the precision, semiring or modulus");
+    return count;
+}
+
+void MpiBatch::multiply(const std::vector<ConstMatrixView>& As,
+    const std::vector<ConstMatrixView>& Bs,
+    const std::vector<MatrixView>& Cs)
+{
+    int count = checkProducts("cannon::MpiBatch::multiply", As, Bs, Cs, true);
+
+    // Pipeline: while product i runs its Cannon steps, product i+1 is
+    // being scattered and product i-1 gathered
+    std::string overflowBlocks, corruptBlocks;
+    MPI_Request scatterRequests[2];
+    int gathering = -1;
+    if (count > 0)
+    {
+        if (rank == root)
+            pack(As[0], Bs[0], 0);
+        scatter(0, scatterRequests);
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        int slot = i % 2;
+        MPI_Waitall(2, scatterRequests, MPI_STATUSES_IGNORE);
+        // the other slot's last scatter was waited for above, one
+        // iteration ago, so its staging buffers are free again
+        if (i + 1 < count)
+        {
+            if (rank == root)
+                pack(As[i + 1], Bs[i + 1], 1 - slot);
+            scatter(1 - slot, scatterRequests);
+        }
+
+        cannonSteps(slot);
+        noteBlocks("product " + std::to_string(i), overflowBlocks, corruptBlocks);
+
+        // 12) Gather Cblocks straight into root's C, finishing the
+        //     previous product's gather first
+        if (gathering >= 0)
+            finishGather(gathering % 2);
+        startGather(slot, Cblock[slot].data(), rank == root ? Cs[i] : MatrixView());
+        gathering = i;
+    }
+    if (gathering >= 0)
+        finishGather(gathering % 2);
+    throwNoted("cannon::MpiBatch::multiply", overflowBlocks, corruptBlocks);
+}
+
+// This rank's C block of a slot, as a distributed matrix
+DistributedMatrix MpiBatch::result(int slot) const
+{
+    DistributedMatrix C;
+    C.layout = layout();
+    C.blockRow = myRow;
+    C.blockCol = myCol;
+    C.block = Cblock[slot];
+    return C;
+}
+
+DistributedMatrix MpiBatch::multiplyDistributed(ConstMatrixView A,
+    ConstMatrixView B)
+{
+    const char* caller = "cannon::MpiBatch::multiplyDistributed";
+    checkProducts(caller, { A }, { B }, {}, false);
+
+    // 9) + 10) + 11) as for one product of multiply, without the gather
+    if (rank == root)
+        pack(A, B, 0);
+    MPI_Request scatterRequests[2];
+    scatter(0, scatterRequests);
+    MPI_Waitall(2, scatterRequests, MPI_STATUSES_IGNORE);
+    cannonSteps(0);
+    std::string overflowBlocks, corruptBlocks;
+    noteBlocks("the product", overflowBlocks, corruptBlocks);
+    throwNoted(caller, overflowBlocks, corruptBlocks);
+    return result(0);
+}
+
+DistributedMatrix MpiBatch::multiplyDistributed(const DistributedMatrix& X,
+    ConstMatrixView D)
+{
+    const char* caller = "cannon::MpiBatch::multiplyDistributed";
+    checkOnGrid(caller, X);
+    return multiplyOnGrid(caller, X, scatterMatrix(caller, D));
+}
+
+DistributedMatrix MpiBatch::multiplyDistributed(const DistributedMatrix& X,
+    const DistributedMatrix& Y)
+{
+    const char* caller = "cannon::MpiBatch::multiplyDistributed";
+    checkOnGrid(caller, X);
+    checkOnGrid(caller, Y);
+    return multiplyOnGrid(caller, X, Y);
+}
+
+DistributedMatrix MpiBatch::distribute(ConstMatrixView A)
+{
+    return scatterMatrix("cannon::MpiBatch::distribute", A);
+}
+
+DistributedMatrix MpiBatch::chain(const std::vector<ConstMatrixView>& As)
+{
+    const char* caller = "cannon::MpiBatch::chain";
+    int count = int(As.size());
+    MPI_Bcast(&count, 1, MPI_INT, root, comm2d);
+    if (count == 0)
+        throw invalid_argument(std::string(caller) + ": needs at least one matrix");
+    if (precision != Precision::Int32)
+        throw invalid_argument(std::string(caller) + ": needs Precision::Int32");
+    // left to right; all square, so the order of the products is free.
+    // Each factor is scattered as it is needed, the running product
+    // never leaves the ranks
+    auto factor = [&](int i) {
+        return rank == root ? As[i] : ConstMatrixView();
+    };
+    DistributedMatrix X = count == 1 ? scatterMatrix(caller, factor(0))
+        : multiplyDistributed(factor(0), factor(1));
+    for (int i = 2; i < count; ++i)
+        X = multiplyOnGrid(caller, X, scatterMatrix(caller, factor(i)));
+    return X;
+}
+
+DistributedMatrix MpiBatch::power(const DistributedMatrix& X, int k)
+{
+    const char* caller = "cannon::MpiBatch::power";
+    checkOnGrid(caller, X);
+    MPI_Bcast(&k, 1, MPI_INT, root, comm2d);
+    if (k < 0)
+        throw invalid_argument(std::string(caller) + ": k must not be negative");
+
+    // the semiring's identity, built in place: one on the diagonal of
+    // the matrix (0 for MinPlus/MaxPlus, 1 otherwise), zero elsewhere
+    DistributedMatrix result = X;
+    std::fill(result.block.begin(), result.block.end(), zero);
+    if (myRow == myCol)
+    {
+        int one = semiring == Semiring::MinPlus
+            || semiring == Semiring::MaxPlus ? 0 : 1;
+        for (int i = 0; i < layout().rowCount(myRow); ++i)
+            result.block[size_t(i) * blockSize + i] = one;
+    }
+
+    // Exponentiation by squaring: result x base^k stays the answer, with
+    // at most 2 log2(k) products, every one of them on the grid
+    DistributedMatrix base = X;
+    bool identity = true;
+    while (k > 0)
+    {
+        if (k & 1)
+        {
+            result = identity ? base : multiplyOnGrid(caller, result, base);
+            identity = false;
+        }
+        k >>= 1;
+        if (k > 0)
+            base = multiplyOnGrid(caller, base, base);
+    }
+    return result;
+}
+
+// Root's n x n view A scattered as a distributed matrix, for a product
+// on the grid (Int32 only)
+DistributedMatrix MpiBatch::scatterMatrix(const char* caller, ConstMatrixView A)
+{
+    int status = precision == Precision::Int32 ? 0 : -3;
+    if (rank == root && status == 0)
+    {
+        if (A.rows != n || A.cols != n)
+            status = -1;
+        else if (!fitsSemiring(A, semiring)
+            || (modulus != 0 && !fitsModulus(A, modulus)))
+            status = -2;
+    }
+    MPI_Bcast(&status, 1, MPI_INT, root, comm2d);
+    if (status == -1)
+        throw invalid_argument(std::string(caller) + ": every matrix must be n x n");
+    if (status == -2)
+        throw invalid_argument(std::string(caller) + ": entries must lie in [-infinity, infinity], or [0, modulus) with a modulus");
+    if (status < 0)
+        throw invalid_argument(std::string(caller) + ": a distributed operand needs Precision::Int32");
+
+    // 9) Scatter A alone
+    if (rank == root)
+        toBlocks(A, reinterpret_cast<int*>(paddedA[0].data()), q, blockSize);
+    MPI_Request scatterRequest;
+    scatterOperand(paddedA[0], Ablock[0], &scatterRequest);
+    MPI_Wait(&scatterRequest, MPI_STATUS_IGNORE);
+    DistributedMatrix X = result(0);
+    std::memcpy(X.block.data(), Ablock[0].data(), X.block.size() * sizeof(int));
+    return X;
+}
+
+// Throws on every rank unless every rank's X is its block of an n x n
+// matrix on this grid, and the grid works in Int32
+void MpiBatch::checkOnGrid(const char* caller, const DistributedMatrix& X)
+{
+    int status = precision != Precision::Int32 ? -3
+        : X.layout.n != n || X.layout.q != q || X.layout.blockSize != blockSize
+            || X.blockRow != myRow || X.blockCol != myCol
+            || int(X.block.size()) != blockSize * blockSize ? -1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &status, 1, MPI_INT, MPI_MIN, comm2d);
+    if (status == -3)
+        throw invalid_argument(std::string(caller) + ": a distributed operand needs Precision::Int32");
+    if (status < 0)
+        throw invalid_argument(std::string(caller) + ": a distributed operand was not made on this grid");
+}
+
+// X x Y for two checked distributed matrices: each rank's blocks already
+// sit where its A and B blocks would before the skew. Every rank holds
+// its own blocks, so the largest |entry| of each side is a reduction
+DistributedMatrix MpiBatch::multiplyOnGrid(const char* caller,
+    const DistributedMatrix& X, const DistributedMatrix& Y)
+{
+    long long largest[2] = { 0, 0 };   // max |X|, max |Y|
+    for (int x : X.block)
+        largest[0] = std::max(largest[0], std::llabs(x));
+    for (int y : Y.block)
+        largest[1] = std::max(largest[1], std::llabs(y));
+    MPI_Allreduce(MPI_IN_PLACE, largest, 2, MPI_LONG_LONG, MPI_MAX, comm2d);
+    wideSums = semiring == Semiring::PlusTimes && modulus == 0
+        && double(n) * double(largest[0]) * double(largest[1]) > INT_MAX;
+
+    // 10) + 11)
+    std::memcpy(Ablock[0].data(), X.block.data(), X.block.size() * sizeof(int));
+    std::memcpy(Bblock[0].data(), Y.block.data(), Y.block.size() * sizeof(int));
+    cannonSteps(0);
+    std::string overflowBlocks, corruptBlocks;
+    noteBlocks("the product", overflowBlocks, corruptBlocks);
+    throwNoted(caller, overflowBlocks, corruptBlocks);
+    return result(0);
+}
+
+void MpiBatch::gather(const DistributedMatrix& X, MatrixView C)
+{
+    int status = 0;
+    if (rank == root && (C.rows != n || C.cols != n))
+        status = -1;
+    MPI_Bcast(&status, 1, MPI_INT, root, comm2d);
+    if (status < 0)
+        throw invalid_argument("cannon::MpiBatch::gather: C must be n x n");
+    startGather(0, X.block.data(), C);
+    finishGather(0);
+}
+
+// Checked mode and ABFT: tell every rank which C blocks of the product
+// that just ran had a sum leave the int range, or could not be put
+// right, appended to overflowBlocks or corruptBlocks as
+// " <product> (row, col)"
+void MpiBatch::noteBlocks(const std::string& product,
+    std::string& overflowBlocks, std::string& corruptBlocks)
+{
+    bool overflows = checkOverflow && wideSums;
+    if (!overflows && !abft)
+        return;
+    std::vector<int> flags(2 * q * q);
+    int mine[2] = { overflows && overflowed, abft && corrupted };
+    MPI_Allgather(mine, 2, MPI_INT, flags.data(), 2, MPI_INT, comm2d);
+    for (int r = 0; r < q * q; ++r)
+    {
+        if (!flags[2 * r] && !flags[2 * r + 1])
+            continue;
+        int coords[2];
+        MPI_Cart_coords(comm2d, r, 2, coords);
+        std::string block = " " + product + " (" + std::to_string(coords[0]) + ", "
+            + std::to_string(coords[1]) + ")";
+        if (flags[2 * r])
+            overflowBlocks += block;
+        if (flags[2 * r + 1])
+            corruptBlocks += block;
+    }
+}
+
+// Throw on every rank for what noteBlocks found, corruption first
+void MpiBatch::throwNoted(const std::string& caller,
+    const std::string& overflowBlocks, const std::string& corruptBlocks)
+{
+    if (!corruptBlocks.empty())
+        throw runtime_error(caller + ": corrupted entries could not be put right in C blocks of" + corruptBlocks);
+    if (!overflowBlocks.empty())
+        throw overflow_error(caller + ": sums left the int range in C blocks of" + overflowBlocks);
+}
+
+void MpiBatch::repeatedSquaring(ConstMatrixView A, MatrixView C, int squarings)
+{
+    int status = precision == Precision::Int32 ? 0 : -3;
+    if (rank == root && status == 0)
+    {
+        if (A.rows != n || A.cols != n || C.rows != n || C.cols != n)
+            status = -1;
+        else if (!fitsSemiring(A, semiring)
+            || (modulus != 0 && !fitsModulus(A, modulus)))
+            status = -2;
+    }
+    MPI_Bcast(&status, 1, MPI_INT, root, comm2d);
+    if (status == -1)
+        throw invalid_argument("cannon::MpiBatch::repeatedSquaring: A and C must be n x n");
+    if (status == -2)
+        throw invalid_argument("cannon::MpiBatch::repeatedSquaring: entries must lie in [-infinity, infinity], or [0, modulus) with a modulus");
+    if (status < 0)
+        throw invalid_argument("cannon::MpiBatch::repeatedSquaring: needs Precision::Int32");
+    // Root settles the number of squarings and whether the sums of any
+    // of them could pass INT_MAX: each square's entries are at most n
+    // times the largest of the last one squared
+    int plan[2] = { squarings, 0 };
+    if (rank == root)
+    {
+        if (plan[0] < 0)
+        {
+            plan[0] = 0;
+            while ((1 << plan[0]) < n - 1)
+                ++plan[0];
+        }
+        double largest = double(maxAbs(A));
+        for (int i = 0; i < plan[0] && semiring == Semiring::PlusTimes
+            && modulus == 0 && !plan[1]; ++i)
+        {
+            largest = double(n) * largest * largest;
+            plan[1] = largest > INT_MAX;
+        }
+    }
+    MPI_Bcast(plan, 2, MPI_INT, root, comm2d);
+    squarings = plan[0];
+    wideSums = plan[1] != 0;
+
+    // 9) Scatter A as both operands, once
+    if (rank == root)
+        pack(A, A, 0);
+    MPI_Request scatterRequests[2];
+    scatter(0, scatterRequests);
+    MPI_Waitall(2, scatterRequests, MPI_STATUSES_IGNORE);
+    std::vector<int>& square = Cblock[0];
+    std::memcpy(square.data(), Ablock[0].data(), square.size() * sizeof(int));
+    std::string overflowBlocks, corruptBlocks;
+
+    // 10) + 11) Square in place: each result block is already where the
+    //     next product needs its A and B blocks before the skew
+    for (int i = 0; i < squarings; ++i)
+    {
+        std::memcpy(Ablock[0].data(), square.data(), square.size() * sizeof(int));
+        std::memcpy(Bblock[0].data(), square.data(), square.size() * sizeof(int));
+        cannonSteps(0);
+        noteBlocks("squaring " + std::to_string(i), overflowBlocks, corruptBlocks);
+    }
+
+    // 12) Gather the last square
+    startGather(0, square.data(), C);
+    finishGather(0);
+    throwNoted("cannon::MpiBatch::repeatedSquaring", overflowBlocks, corruptBlocks);
+}
+
+void multiply(ConstMatrixView A,
+    ConstMatrixView B,
+    MatrixView C,
+    MPI_Comm comm,
+    const MpiOptions& options)
+{
+    MpiBatch batch(A.rows, comm, options);
+    batch.multiply({ A }, { B }, { C });
+}
+
+void repeatedSquaring(ConstMatrixView A,
+    MatrixView C,
+    MPI_Comm comm,
+    int squarings,
+    const MpiOptions& options)
+{
+    MpiBatch batch(A.rows, comm, options);
+    batch.repeatedSquaring(A, C, squarings);
+}
+
+void chainProduct(const std::vector<ConstMatrixView>& As,
+    MatrixView C,
+    MPI_Comm comm,
+    const MpiOptions& options)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    int n = rank == options.root && !As.empty() ? As[0].rows : 0;
+    MpiBatch batch(n, comm, options);
+    batch.gather(batch.chain(As), C);
+}
+
+void matrixPower(ConstMatrixView A,
+    int k,
+    MatrixView C,
+    MPI_Comm comm,
+    const MpiOptions& options)
+{
+    MpiBatch batch(A.rows, comm, options);
+    batch.gather(batch.power(batch.distribute(A), k), C);
+}
+
+} // namespace cannon
@@ -0,0 +1,397 @@
+#pragma once
+
+#include <mpi.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cannon.h"
+
+// Distributed Cannon engine: one block per rank on a q x q periodic grid.
+namespace cannon {
+
+struct MpiOptions {
+    int root = 0;   // rank of comm that owns A, B and C
+    // Tiling of each rank's local block multiply. While it is left at
+    // zero and tuningFile is set, every rank looks up the tiling tuned
+    // for its own CPU and block size (see cannonTuning.h)
+    KernelTiling tiling;
+    std::string  tuningFile;
+    // Width A and B blocks are scattered, shifted and multiplied at
+    // (C stays int). Taken from root; every entry of A and B must fit.
+    Precision    precision = Precision::Int32;
+    // Above zero, A and B blocks travel between ranks compressed: one
+    // count when all zero, CSR when at most this fraction is non-zero.
+    // Products with an all-zero side are skipped and CSR A blocks use the
+    // sparse kernel. Taken from root; Int32 precision only.
+    double       sparseDensity = 0;
+    // Above zero, the speed in bytes per second of a link between ranks:
+    // dense A and B blocks then travel bit-packed, each entry as its
+    // offset from the block's smallest in as few bits as the block's
+    // range needs, whenever the bytes saved at that speed take longer
+    // than unpacking (timed on each rank) does. Blocks are packed once
+    // per product and forwarded packed; each step's exchange overlaps
+    // the local multiply. Taken from root; not with sparseDensity.
+    double       compressBytesPerSecond = 0;
+    // If set, ranks that share a node (MPI_Comm_split_type) are placed
+    // on one compact tile of the Cannon grid, so most row (A) and column
+    // (B) shifts stay inside a node; otherwise rank r of comm sits at
+    // (r / q, r % q). Taken from root.
+    bool         nodeAware = false;
+    // What the product adds and multiplies with (see cannon.h). Taken
+    // from root; anything but PlusTimes needs Precision::Int32.
+    Semiring     semiring = Semiring::PlusTimes;
+    // Above zero, products are taken modulo this (see cannon.h). Taken
+    // from root; PlusTimes, Int32 and no sparseDensity only.
+    int          modulus = 0;
+    // PlusTimes batches where some product's sums could pass INT_MAX are
+    // accumulated in 64 bits (see Options::checkOverflow). If set, taken
+    // from root, the call throws std::overflow_error on every rank once
+    // the results are gathered, naming the C blocks whose sums left the
+    // int range.
+    bool         checkOverflow = false;
+    // Above zero, every checkpointEvery steps of the main Cannon loop each
+    // rank saves its A, B and C blocks and the step into checkpointDir
+    // (its own, meant to be node-local scratch; empty is the working
+    // directory) as cannon-<rank in MPI_COMM_WORLD>-<batch>.0 or .1 in
+    // turn, batch counting this process's checkpointing MpiBatches. The
+    // blocks are copied and the loop goes on while a background thread
+    // writes them; the next checkpoint waits until the last one is whole
+    // on every rank, so the older file can go. Every file carries the
+    // job's token (kept in cannon-<rank>.job), the batch, n, q and the
+    // precision; a fresh job draws a new token and deletes a batch's old
+    // files, and a batch deletes its own when it is destroyed, the last
+    // one alive the .job file too. With
+    // restart set, the job keeps the token its ranks recorded and the
+    // ranks agree on the newest checkpoint all of them hold for the
+    // batch, grid shape and position: products before it are computed
+    // again (the program must ask for the same ones), the product it
+    // belongs to resumes after its step, and a batch with no common
+    // checkpoint starts afresh. Taken from root; not with sparseDensity
+    // or compressBytesPerSecond. multiplyConcurrent does not checkpoint.
+    int          checkpointEvery = 0;
+    std::string  checkpointDir;
+    bool         restart = false;
+    // Algorithm-based fault tolerance. If set, every A block carries a
+    // checksum row (its column sums) and every B block a checksum column
+    // (its row sums) through the skew and every shift, and each step
+    // multiplies them along into the row and column sums the C block
+    // should have: 2b^2 more multiply-adds per b^3. After each step a rank
+    // checks its C block against them (modulo 2^32) and puts a single
+    // wrong entry right. More wrong entries, a hit checksum, or an A or B
+    // block that arrives from the skew or a shift not matching its
+    // checksums cannot be put right: the call
+    // then throws std::runtime_error on every rank once the results are
+    // in, naming those C blocks. Taken from root; PlusTimes, Int32 and no
+    // modulus, sparseDensity or compressBytesPerSecond only.
+    // multiplyConcurrent does not use it.
+    bool         abft = false;
+};
+
+namespace detail {
+
+// What is wrong with the combination of options' precision, semiring,
+// modulus, sparseDensity, compressBytesPerSecond, checkpointEvery and
+// abft, or nullptr if nothing is. Every MPI entry point checks the values
+// taken from root with it on every rank, so all of them throw together.
+const char* optionsError(const MpiOptions& options);
+
+// Test hook: a fault the main Cannon loop of MpiBatches built after
+// injectFault plants in every product they run, on the rank of their
+// comm named by rank, at step. CEntry flips an entry of the C block
+// after the step's multiply, AEntry one of the A block after its shift,
+// RowChecksum and ColumnChecksum one of the C block's checksums. Stop
+// throws std::runtime_error on every rank, whatever rank says, right
+// after the step's checkpoint: the batch, once destroyed, leaves its
+// checkpoints and the .job file behind as a crash would, and the process
+// forgets the job, so the batches built next start like those of the
+// restarted program. Stop is for batches of one product. Every rank must
+// inject the same fault; None (the default) turns it off.
+struct InjectedFault {
+    enum Kind { None, CEntry, AEntry, RowChecksum, ColumnChecksum, Stop };
+    Kind kind = None;
+    int  rank = 0;
+    int  step = 0;
+};
+void injectFault(const InjectedFault& fault);
+
+} // namespace detail
+
+// Computes C = A x B over comm, whose size must be a perfect square q*q.
+// Collective: every rank of comm must call it. Only root's views are
+// used (A and B read, C written; all n x n); n is broadcast from root,
+// so the other ranks may pass empty views.
+// Throws std::invalid_argument on every rank if comm is not square.
+void multiply(ConstMatrixView A,
+    ConstMatrixView B,
+    MatrixView C,
+    MPI_Comm comm,
+    const MpiOptions& options = MpiOptions());
+
+// Where the blocks of an n x n matrix live on a q x q Cannon grid: block
+// (i, j) covers rows [i*b, i*b + b) and columns [j*b, j*b + b) with
+// b = ceil(n / q), clipped to n, and is held by the rank of comm (as
+// passed to MpiBatch) owner(i, j). Blocks wholly past n are pure padding.
+struct BlockLayout {
+    int n = 0;
+    int q = 0;
+    int blockSize = 0;
+    std::vector<int> owners;   // at i * q + j
+
+    int owner(int blockRow, int blockCol) const { return owners[blockRow * q + blockCol]; }
+    // rows (columns) of the matrix block row (column) i holds
+    int rowBegin(int i) const { return i * blockSize; }
+    int rowCount(int i) const
+    {
+        int count = n - i * blockSize;
+        return count < 0 ? 0 : count < blockSize ? count : blockSize;
+    }
+    int colBegin(int j) const { return rowBegin(j); }
+    int colCount(int j) const { return rowCount(j); }
+};
+
+// An n x n matrix left block-distributed on an MpiBatch's grid: every
+// rank holds its own block of layout, blockSize x blockSize and
+// row-major, with the semiring's zero past n. Only valid with the
+// MpiBatch that made it.
+struct DistributedMatrix {
+    BlockLayout layout;
+    int blockRow = 0;
+    int blockCol = 0;
+    std::vector<int> block;
+
+    // entry (i, j) of this rank's block, i.e. of the matrix at
+    // (layout.rowBegin(blockRow) + i, layout.colBegin(blockCol) + j)
+    int operator()(int i, int j) const { return block[size_t(i) * layout.blockSize + j]; }
+};
+
+// A Cannon grid kept alive across many independent n x n products: the
+// Cartesian communicator, the block datatypes, the displacements and all
+// block and padded buffers are set up once. Results are gathered
+// straight into the caller's C, so root holds no padded copy of it.
+// multiply() pipelines a queue of products through the grid, scattering
+// product i+1 and gathering product i-1 while product i is being
+// computed. multiplyDistributed() instead leaves C on the grid, where it
+// can be the left operand of the next product without a round trip
+// through root.
+//
+// Construction, every member function and destruction are collective
+// over comm. n is taken from root and broadcast.
+class MpiBatch {
+public:
+    MpiBatch(int n, MPI_Comm comm, const MpiOptions& options = MpiOptions());
+    ~MpiBatch();
+
+    MpiBatch(const MpiBatch&) = delete;
+    MpiBatch& operator=(const MpiBatch&) = delete;
+
+    // Computes Cs[i] = As[i] x Bs[i] for every i. Only root's lists are
+    // used (the count is broadcast); every view must be n x n.
+    void multiply(const std::vector<ConstMatrixView>& As,
+        const std::vector<ConstMatrixView>& Bs,
+        const std::vector<MatrixView>& Cs);
+
+    // Computes C = A^(2^squarings) in the semiring by repeated squaring.
+    // A is scattered once and every square stays on the grid as both
+    // operands of the next, so nothing goes through root until the final
+    // gather. squarings < 0 means ceil(log2(n - 1)), enough for paths of
+    // up to n - 1 edges when A has the semiring's one on its diagonal
+    // (0 for MinPlus/MaxPlus, 1 otherwise). Only root's views are used.
+    // Needs Precision::Int32.
+    void repeatedSquaring(ConstMatrixView A, MatrixView C, int squarings = -1);
+
+    // C = A x B left block-distributed instead of gathered. Only root's
+    // views are used.
+    DistributedMatrix multiplyDistributed(ConstMatrixView A, ConstMatrixView B);
+    // C = X x D for an X already on this grid, e.g. the last stage's
+    // result, and root's view D; X never leaves the ranks. Needs
+    // Precision::Int32.
+    DistributedMatrix multiplyDistributed(const DistributedMatrix& X,
+        ConstMatrixView D);
+    // C = X x Y, both already on this grid. Needs Precision::Int32.
+    DistributedMatrix multiplyDistributed(const DistributedMatrix& X,
+        const DistributedMatrix& Y);
+    // Root's view A scattered onto the grid as an operand. Needs
+    // Precision::Int32.
+    DistributedMatrix distribute(ConstMatrixView A);
+    // As[0] x As[1] x ... x As[m-1], left to right. Each factor is
+    // scattered as it is needed and the running product stays on the
+    // ranks. Only root's list is used. Needs Precision::Int32.
+    DistributedMatrix chain(const std::vector<ConstMatrixView>& As);
+    // X^k in the semiring by exponentiation by squaring (at most
+    // 2 log2(k) products, all on the grid); X^0 is the semiring's
+    // identity. k is taken from root. Needs Precision::Int32.
+    DistributedMatrix power(const DistributedMatrix& X, int k);
+    // Gather X into root's n x n view C (other ranks' C is unused)
+    void gather(const DistributedMatrix& X, MatrixView C);
+
+    int size() const { return n; }
+    BlockLayout layout() const { return { n, q, blockSize, owners }; }
+    // Checkpoints that some rank could not write, as found when the next
+    // one starts; that one went over it instead (see
+    // MpiOptions::checkpointEvery)
+    long long failedCheckpoints() const { return checkpointFailures; }
+    // C entries this rank's ABFT checks have put right so far
+    long long correctedEntries() const { return corrected; }
+
+private:
+    int checkProducts(const char* caller,
+        const std::vector<ConstMatrixView>& As,
+        const std::vector<ConstMatrixView>& Bs,
+        const std::vector<MatrixView>& Cs, bool gathered);
+    void pack(ConstMatrixView A, ConstMatrixView B, int slot);
+    void startGather(int slot, const int* block, MatrixView C);
+    void finishGather(int slot);
+    void scatter(int slot, MPI_Request* requests);
+    void scatterOperand(std::vector<char>& padded, std::vector<char>& block,
+        MPI_Request* request);
+    DistributedMatrix result(int slot) const;
+    DistributedMatrix scatterMatrix(const char* caller, ConstMatrixView A);
+    void checkOnGrid(const char* caller, const DistributedMatrix& X);
+    DistributedMatrix multiplyOnGrid(const char* caller,
+        const DistributedMatrix& X, const DistributedMatrix& Y);
+    void cannonSteps(int slot);
+    void shiftOperand(std::vector<char>& block, std::vector<int>& packed,
+        int src, int dst);
+    void multiplyLocal(int slot);
+    void compressOperands(int slot);
+    void expandOperand(const std::vector<int>& packed, std::vector<char>& block);
+    void compressedSteps(int slot);
+    template <typename S>
+    void multiplyLocalAs(int slot);
+    void noteBlocks(const std::string& product, std::string& overflowBlocks,
+        std::string& corruptBlocks);
+    void throwNoted(const std::string& caller,
+        const std::string& overflowBlocks, const std::string& corruptBlocks);
+    void addChecksums(int slot);
+    void checkOperands(int slot);
+    void sumBlock(const std::vector<int>& C, std::vector<unsigned>& sums) const;
+    void updateChecksums(int slot);
+    void correctBlock(int slot);
+    bool faultAt(detail::InjectedFault::Kind kind, int step) const;
+    void startJob(bool restarting);
+    void removeCheckpoints();
+    void checkpoint(int slot, long long run, int step);
+    void findCheckpoint();
+    void resume(int slot);
+
+    KernelTiling tiling;
+    Precision    precision;
+    double       sparseDensity;
+    double       compressBytesPerSecond;   // 0 when off
+    double       unpackSeconds;            // per entry, measured
+    Semiring     semiring;
+    int          zero;           // the semiring's zero
+    int          modulus;        // 0 when off
+    bool         checkOverflow;
+    bool         wideSums;       // for the product(s) now running
+    bool         overflowed;     // this rank's C block, current product
+    bool         abft;
+    bool         corrupted;      // ABFT could not put the C block right
+    long long    corrected;
+    detail::InjectedFault fault;   // see detail::injectFault
+    MPI_Comm     comm2d;
+    // one A or B entry, a block of them in the padded staging arenas,
+    // and the part of this rank's C block inside the n x n matrix
+    MPI_Datatype elementType, operandBlockType, clippedBlockType;
+    int elementBytes;
+    // ranks in comm2d, where rank r sits at (r / q, r % q); owners maps
+    // them back to comm
+    int rank, root;
+    std::vector<int> owners;
+    int q, myRow, myCol;
+    int n, blockSize, nPadded;
+    // entries in a shifted A or B block: b*b, and b checksums with ABFT
+    int operandCount;
+    std::vector<int> displs, counts;
+    // a gather in flight per slot: this rank's send of its clipped C
+    // block and, on root, one receive per rank straight into C
+    bool sendsC;
+    std::vector<MPI_Request> gatherRequests[2];
+
+    // two slots so one product can be in flight while another computes.
+    // A and B hold elementBytes-wide entries
+    std::vector<char> Ablock[2], Bblock[2];
+    std::vector<int>  Cblock[2];
+    // root only: zero-padded staging block arenas (see cannonGrid.h)
+    std::vector<char> paddedA[2], paddedB[2];
+    // sparse shifts: the compressed A and B blocks of the running product,
+    // a receive buffer and B expanded for the multiply (1 + b*b ints each).
+    // Compressed shifts use the first three and a receive buffer for B
+    std::vector<int>  packedA, packedB, packedRecv, expandedB, packedRecvB;
+    // ABFT: the row sums of the running C block then its column sums, as
+    // the checksums say they should be, and the same taken from C
+    std::vector<unsigned> checkC, sumsC;
+    // checkpoints: files are checkpointPath + "0" or "1", the one written
+    // next is checkpointsWritten % 2. runs counts the Cannon runs on this
+    // grid; resumeRun (-1 for none) is the one to pick up after step
+    // resumeStep from resumeData, the file read at construction
+    int          checkpointEvery;   // 0 when off
+    int          batchIndex;
+    std::string  checkpointPath;    // empty when neither option is set
+    std::string  jobPath;
+    long long    checkpointsWritten;
+    long long    checkpointFailures;
+    std::thread  checkpointWriter;
+    bool         lastWriteFailed;   // set by checkpointWriter
+    bool         stopped;           // by an injected Stop
+    long long    runs, resumeRun;
+    int          resumeStep;
+    std::vector<char> resumeData;
+};
+
+// C = A^(2^squarings) on comm, see MpiBatch::repeatedSquaring.
+// Collective; only root's views are used.
+void repeatedSquaring(ConstMatrixView A,
+    MatrixView C,
+    MPI_Comm comm,
+    int squarings = -1,
+    const MpiOptions& options = MpiOptions());
+
+// C = As[0] x ... x As[m-1] on comm, see MpiBatch::chain, and C = A^k,
+// see MpiBatch::power. Every matrix is n x n; n and k are taken from
+// root. Collective; only root's views are used.
+void chainProduct(const std::vector<ConstMatrixView>& As,
+    MatrixView C,
+    MPI_Comm comm,
+    const MpiOptions& options = MpiOptions());
+void matrixPower(ConstMatrixView A,
+    int k,
+    MatrixView C,
+    MPI_Comm comm,
+    const MpiOptions& options = MpiOptions());
+
+// One independent product for multiplyConcurrent; all three views are
+// square with the same n, but n may differ between products
+struct Product {
+    ConstMatrixView A;
+    ConstMatrixView B;
+    MatrixView      C;
+};
+
+// Machine parameters for the cost model that sizes sub-grids.
+// The estimate for one n x n product on a g x g grid (b = ceil(n/g)) is
+//   2 g b^3 / flopsPerSecond                      local multiplies
+// + (4g - 2) (latencySeconds + 4 b^2 / bytesPerSecond)   skew + shifts
+// + 12 n^2 / bytesPerSecond                       scatter A, B, gather C
+struct GridCostModel {
+    double flopsPerSecond = 2e9;
+    double latencySeconds = 2e-6;
+    double bytesPerSecond = 5e9;
+};
+
+// Runs several independent products at once. comm is split into as many
+// equal g x g Cartesian grids as fit, g chosen by the cost model to
+// minimise the estimated makespan; products are assigned to sub-grids
+// longest-first and each sub-grid runs its share one after the other.
+// comm's size need not be square; ranks left over are idle.
+// Only root's list is used, the count and sizes are broadcast. Root sends
+// every sub-grid its operands directly from the caller's (strided) views
+// and receives the results straight into them.
+// Collective over comm.
+void multiplyConcurrent(const std::vector<Product>& products,
+    MPI_Comm comm,
+    const GridCostModel& model = GridCostModel(),
+    const MpiOptions& options = MpiOptions());
+
+} // namespace cannon
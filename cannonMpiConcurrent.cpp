@@ -0,0 +1,267 @@
+#include "cannonMpi.h"
+#include "cannonGrid.h"
+
+#include <algorithm>   // sort, min_element
+#include <cmath>
+#include <memory>
+#include <numeric>     // iota
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+namespace cannon {
+
+// Estimated seconds for one n x n product on a g x g grid (see cannonMpi.h)
+static double productCost(int n, int g, const GridCostModel& model)
+{
+    double b = (n + g - 1) / g;
+    double compute = 2.0 * g * b * b * b / model.flopsPerSecond;
+    double shifts = (4.0 * g - 2.0)
+        * (model.latencySeconds + 4.0 * b * b / model.bytesPerSecond);
+    double distribute = 12.0 * double(n) * n / model.bytesPerSecond;
+    return compute + shifts + distribute;
+}
+
+// The sub-grid side chosen for a set of products, which sub-grid each
+// product runs on and the order the products are taken in
+struct ConcurrentPlan {
+    int gridSide;
+    int groupCount;
+    vector<int> groupOf;
+    vector<int> order;
+};
+
+// Try every grid side g with g*g <= P: P / (g*g) sub-grids, products
+// assigned longest-first to the least loaded one. Keep the g with the
+// smallest estimated makespan. Deterministic, so every rank gets the
+// same plan from the same sizes.
+static ConcurrentPlan planGrids(const vector<int>& sizes, int P,
+    const GridCostModel& model)
+{
+    int count = sizes.size();
+    ConcurrentPlan best{ 1, P, vector<int>(count, 0), vector<int>(count) };
+    double bestMakespan = -1;
+
+    for (int g = 1; g * g <= P; ++g) {
+        int groups = P / (g * g);
+        vector<double> cost(count);
+        for (int i = 0; i < count; ++i)
+            cost[i] = productCost(sizes[i], g, model);
+
+        vector<int> order(count);
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(),
+            [&](int x, int y) { return cost[x] > cost[y]; });
+
+        vector<double> load(groups, 0.0);
+        vector<int> groupOf(count);
+        for (int i : order) {
+            int least = int(min_element(load.begin(), load.end()) - load.begin());
+            groupOf[i] = least;
+            load[least] += cost[i];
+        }
+        double makespan = *max_element(load.begin(), load.end());
+        if (bestMakespan < 0 || makespan < bestMakespan) {
+            bestMakespan = makespan;
+            best = { g, groups, groupOf, order };
+        }
+    }
+    return best;
+}
+
+void multiplyConcurrent(const std::vector<Product>& products,
+    MPI_Comm comm,
+    const GridCostModel& model,
+    const MpiOptions& options)
+{
+    int P, rank;
+    MPI_Comm_size(comm, &P);
+    MPI_Comm_rank(comm, &rank);
+    int root = options.root;
+
+    // 1) Root broadcasts the precision, the semiring, the modulus, the
+    //    overflow check, node-aware placement, the sparse density, the
+    //    compression link speed, how many products there are and their
+    //    sizes (-1 for a bad shape, -2 for entries that do not fit)
+    int codes[5] = { int(options.precision), int(options.semiring), options.modulus,
+        int(options.checkOverflow), int(options.nodeAware) };
+    MPI_Bcast(codes, 5, MPI_INT, root, comm);
+    double rates[2] = { options.sparseDensity, options.compressBytesPerSecond };
+    MPI_Bcast(rates, 2, MPI_DOUBLE, root, comm);
+    // sub-grids would reject a bad combination one group at a time, with
+    // root's sends to the others already posted; every rank checks first
+    MpiOptions taken;
+    taken.precision = Precision(codes[0]);
+    taken.semiring = Semiring(codes[1]);
+    taken.modulus = codes[2];
+    taken.sparseDensity = rates[0];
+    taken.compressBytesPerSecond = rates[1];
+    if (const char* error = detail::optionsError(taken))
+        throw invalid_argument(std::string("cannon::multiplyConcurrent: ") + error);
+    int count = (rank == root) ? int(products.size()) : 0;
+    MPI_Bcast(&count, 1, MPI_INT, root, comm);
+    vector<int> sizes(count);
+    if (rank == root)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const Product& product = products[i];
+            int n = product.A.rows;
+            bool square = product.A.cols == n && product.B.rows == n
+                && product.B.cols == n && product.C.rows == n
+                && product.C.cols == n && n > 0;
+            bool fits = square
+                && detail::fitsPrecision(product.A, options.precision)
+                && detail::fitsPrecision(product.B, options.precision)
+                && detail::fitsSemiring(product.A, options.semiring)
+                && detail::fitsSemiring(product.B, options.semiring)
+                && (options.modulus == 0
+                    || (detail::fitsModulus(product.A, options.modulus)
+                        && detail::fitsModulus(product.B, options.modulus)));
+            sizes[i] = !square ? -1 : !fits ? -2 : n;
+        }
+    }
+    MPI_Bcast(sizes.data(), count, MPI_INT, root, comm);
+    for (int n : sizes)
+    {
+        if (n == -1)
+            throw invalid_argument("cannon::multiplyConcurrent: every product must be n x n");
+        if (n < 0)
+            throw invalid_argument("cannon::multiplyConcurrent: an entry of A or B does not fit the precision, semiring or modulus");
+    }
+    if (count == 0)
+        return;
+
+    // 2) Choose the sub-grid side and assign products to sub-grids
+    ConcurrentPlan plan = planGrids(sizes, P, model);
+    int groupRanks = plan.gridSide * plan.gridSide;
+    int usedRanks = plan.groupCount * groupRanks;
+
+    // 3) Split comm into the sub-grids. Root is made rank 0 of its own
+    //    sub-grid so that sub-grid can work on the caller's views in place
+    int myGroup = rank < usedRanks ? rank / groupRanks : MPI_UNDEFINED;
+    int rootGroup = root < usedRanks ? root / groupRanks : -1;
+    MPI_Comm sub;
+    MPI_Comm_split(comm, myGroup, rank == root ? -1 : rank, &sub);
+    auto groupRoot = [&](int group) {
+        return group == rootGroup ? root : group * groupRanks;
+    };
+
+    // 4) Root posts every transfer for the other sub-grids up front,
+    //    straight from and into the caller's strided views
+    vector<MPI_Request> requests;
+    if (rank == root)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            int group = plan.groupOf[plan.order[i]];
+            if (group == rootGroup)
+                continue;
+            const Product& product = products[plan.order[i]];
+            int n = sizes[plan.order[i]];
+            MPI_Datatype viewA, viewB, viewC;
+            MPI_Type_vector(n, n, product.A.stride, MPI_INT, &viewA);
+            MPI_Type_vector(n, n, product.B.stride, MPI_INT, &viewB);
+            MPI_Type_vector(n, n, product.C.stride, MPI_INT, &viewC);
+            MPI_Type_commit(&viewA);
+            MPI_Type_commit(&viewB);
+            MPI_Type_commit(&viewC);
+            // messages between one pair of ranks do not overtake each
+            // other, so per-kind tags keep the products in plan order
+            requests.resize(requests.size() + 3);
+            MPI_Request* r = &requests[requests.size() - 3];
+            MPI_Isend(product.A.data, 1, viewA, groupRoot(group), 0, comm, &r[0]);
+            MPI_Isend(product.B.data, 1, viewB, groupRoot(group), 1, comm, &r[1]);
+            MPI_Irecv(product.C.data, 1, viewC, groupRoot(group), 2, comm, &r[2]);
+            MPI_Type_free(&viewA);
+            MPI_Type_free(&viewB);
+            MPI_Type_free(&viewC);
+        }
+    }
+
+    // 5) Every sub-grid works through its products in plan order,
+    //    keeping its MpiBatch while consecutive products share n. An
+    //    overflow is noted and the sub-grid carries on, so every result
+    //    still reaches root
+    vector<int> overflowed(count, 0);
+    if (sub != MPI_COMM_NULL)
+    {
+        int subRank;
+        MPI_Comm_rank(sub, &subRank);
+        unique_ptr<MpiBatch> batch;
+        vector<int> Abuf, Bbuf, Cbuf;
+        for (int i = 0; i < count; ++i)
+        {
+            int index = plan.order[i];
+            if (plan.groupOf[index] != myGroup)
+                continue;
+            int n = sizes[index];
+            if (!batch || batch->size() != n)
+            {
+                batch.reset();
+                MpiOptions subOptions = options;
+                subOptions.root = 0;
+                subOptions.precision = Precision(codes[0]);
+                subOptions.semiring = Semiring(codes[1]);
+                subOptions.modulus = codes[2];
+                subOptions.checkOverflow = codes[3] != 0;
+                subOptions.nodeAware = codes[4] != 0;
+                subOptions.sparseDensity = rates[0];
+                subOptions.compressBytesPerSecond = rates[1];
+                // sub-grids do not checkpoint or run ABFT (see MpiOptions)
+                subOptions.checkpointEvery = 0;
+                subOptions.restart = false;
+                subOptions.abft = false;
+                batch.reset(new MpiBatch(n, sub, subOptions));
+            }
+
+            bool remote = subRank == 0 && myGroup != rootGroup;
+            if (remote)
+            {
+                Abuf.resize(size_t(n) * n);
+                Bbuf.resize(size_t(n) * n);
+                Cbuf.resize(size_t(n) * n);
+                MPI_Recv(Abuf.data(), n * n, MPI_INT, root, 0, comm, MPI_STATUS_IGNORE);
+                MPI_Recv(Bbuf.data(), n * n, MPI_INT, root, 1, comm, MPI_STATUS_IGNORE);
+            }
+            try
+            {
+                if (subRank != 0)
+                    batch->multiply({}, {}, {});
+                else if (!remote)
+                    batch->multiply({ products[index].A }, { products[index].B },
+                        { products[index].C });
+                else
+                    batch->multiply({ ConstMatrixView(Abuf.data(), n) },
+                        { ConstMatrixView(Bbuf.data(), n) },
+                        { MatrixView(Cbuf.data(), n) });
+            }
+            catch (const overflow_error&)
+            {
+                overflowed[index] = 1;
+            }
+            if (remote)
+                MPI_Send(Cbuf.data(), n * n, MPI_INT, root, 2, comm);
+        }
+        batch.reset();
+        MPI_Comm_free(&sub);
+    }
+
+    // 6) Root waits for the other sub-grids' results
+    MPI_Waitall(int(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+
+    // 7) Every rank learns which products overflowed
+    if (codes[3])
+    {
+        MPI_Allreduce(MPI_IN_PLACE, overflowed.data(), count, MPI_INT, MPI_MAX, comm);
+        string which;
+        for (int i = 0; i < count; ++i)
+            if (overflowed[i])
+                which += " " + to_string(i);
+        if (!which.empty())
+            throw overflow_error("cannon::multiplyConcurrent: sums left the int range in products" + which);
+    }
+}
+
+} // namespace cannon
@@ -0,0 +1,278 @@
+#include <algorithm>   // rotate
+#include <omp.h>
+
+#include "cannonGrid.h"
+
+using namespace std;
+
+namespace cannon {
+namespace detail {
+
+// Rotate each row of the block grid left by the amounts in rowShifts.
+// Orphaned worksharing: shares the rows among the enclosing team and
+// does not wait, so the caller decides where to put the barrier.
+static void shiftBlockRows(Grid& blocks,
+    const vector<int>& rowShifts) {
+    int gridSize = blocks.size();
+
+    #pragma omp for nowait
+    for (int r = 0; r < gridSize; ++r) {
+        int shift = rowShifts[r] % gridSize;
+        if (shift == 0) continue;
+        rotate(blocks[r].begin(),
+            blocks[r].begin() + shift,
+            blocks[r].end());
+    }
+}
+
+// Rotate each column of the block grid up by the amounts in colShifts.
+// Same worksharing contract as shiftBlockRows.
+static void shiftBlockCols(Grid& blocks,
+    const vector<int>& colShifts) {
+    int gridSize = blocks.size();
+
+    #pragma omp for nowait
+    for (int c = 0; c < gridSize; ++c) {
+        int shift = colShifts[c] % gridSize;
+        if (shift == 0) continue;
+        vector<Block> column(gridSize);
+
+        for (int r = 0; r < gridSize; ++r)
+            column[r].swap(blocks[r][c]);
+        rotate(column.begin(),
+            column.begin() + shift,
+            column.end());
+        for (int r = 0; r < gridSize; ++r)
+            blocks[r][c].swap(column[r]);
+    }
+}
+
+// Fill the gridSize x gridSize shells of blocks from the matrix, padded
+// with the semiring's zero on the way (loadBlock).
+// Orphaned worksharing with the same static collapse(2) distribution as
+// the multiply in multiplyOmp, so each block is allocated and first
+// written by the thread that multiplies it at step 0 and its pages land
+// on that thread's NUMA node. Blocks are placed where the initial Cannon
+// skew would move them: row r left by r when skewRows (A), otherwise
+// column c up by c (B).
+static void touchBlocks(ConstMatrixView matrix,
+    Grid& blocks,
+    int   blockSize,
+    bool  skewRows,
+    int   zero)
+{
+    int gridSize = blocks.size();
+
+    #pragma omp for collapse(2) schedule(runtime) nowait
+    for (int r = 0; r < gridSize; ++r) {
+        for (int c = 0; c < gridSize; ++c) {
+            // A row r is skewed left by r, B column c up by c
+            int fromRow = skewRows ? r : (r + c) % gridSize;
+            int fromCol = skewRows ? (c + r) % gridSize : c;
+            loadBlock(matrix, fromRow, fromCol, blockSize, zero, blocks[r][c]);
+        }
+    }
+}
+
+// Allocate the blocks of C filled with the semiring's zero, with the
+// same distribution as touchBlocks.
+static void touchZeroBlocks(Grid& blocks, int blockSize, int zero)
+{
+    int gridSize = blocks.size();
+
+    #pragma omp for collapse(2) schedule(runtime) nowait
+    for (int r = 0; r < gridSize; ++r)
+        for (int c = 0; c < gridSize; ++c)
+            blocks[r][c].assign(blockSize, vector<int>(blockSize, zero));
+}
+
+// Cannon multiplication emulation: computes A x B = C
+// using processCount virtual processes, padding as needed.
+// The virtual processes are blocks of work shared among threadCount
+// OpenMP threads, so the grid can be finer than the core count.
+void multiplyOmp(ConstMatrixView matrixA,
+    ConstMatrixView matrixB,
+    MatrixView    matrixC,
+    int           processCount,
+    int           threadCount,
+    Affinity      affinity,
+    const BlockKernel& kernel,
+    BlockFlags&   overflowed)
+{
+    int matrixSize = matrixA.rows;
+
+    // 1) + 2) Grid and block size
+    GridLayout layout = gridLayout(matrixSize, processCount);
+    int gridSize = layout.gridSize;
+    int blockSize = layout.blockSize;
+    if (threadCount <= 0)
+        threadCount = omp_get_num_procs();
+    int zero = semiringZero(kernel.semiring);
+    overflowed.assign(gridSize, vector<char>(gridSize, 0));
+
+    // 3) + 4) + 5) + 6) Grid shells only: the blocks themselves are allocated
+    //    inside the team by the thread that will multiply them
+    Grid blockGridA(gridSize, vector<Block>(gridSize));
+    Grid blockGridB(gridSize, vector<Block>(gridSize));
+    Grid blockGridC(gridSize, vector<Block>(gridSize));
+
+    // every step rotates each row/column by 1
+    vector<int> unitShifts(gridSize, 1);
+
+    // 7) One team for the whole computation: first-touch partition,
+    //    then gridSize steps of multiply + rotate as worksharing loops
+    //    separated by barriers
+    auto cannonTeam = [&]() {
+        // the three grids are independent, so their partitions
+        // share one barrier
+        touchBlocks(matrixA, blockGridA, blockSize, true, zero);
+        touchBlocks(matrixB, blockGridB, blockSize, false, zero);
+        touchZeroBlocks(blockGridC, blockSize, zero);
+        #pragma omp barrier
+
+        for (int step = 0; step < gridSize; ++step) {
+            // local multiply-accumulate (implicit barrier at the end);
+            // the schedule comes from omp_set_schedule below and must be
+            // static whenever placement matters
+            #pragma omp for collapse(2) schedule(runtime)
+            for (int r = 0; r < gridSize; ++r) {
+                for (int c = 0; c < gridSize; ++c) {
+                    overflowed[r][c] |= multiplyAcc(blockGridA[r][c],
+                        blockGridB[r][c],
+                        blockGridC[r][c], kernel);
+                }
+            }
+            // rotate each row/column by 1 for next step
+            shiftBlockRows(blockGridA, unitShifts);
+            shiftBlockCols(blockGridB, unitShifts);
+            #pragma omp barrier
+        }
+
+        // 8) Each C block is copied out, dropping the padding, by the
+        //    thread that computed it
+        #pragma omp for collapse(2) schedule(runtime)
+        for (int r = 0; r < gridSize; ++r)
+            for (int c = 0; c < gridSize; ++c)
+                storeBlock(blockGridC[r][c], r, c, matrixC);
+    };
+
+    // Compact packs consecutive threads (and so consecutive bands of grid
+    // rows) onto one socket; scatter spreads them over the machine.
+    // Without pinning the OS may migrate threads, so blocks are simply
+    // handed out dynamically. The caller's runtime schedule is put back
+    // afterwards, so its own schedule(runtime) loops are not affected
+    omp_sched_t callerKind;
+    int callerChunk;
+    omp_get_schedule(&callerKind, &callerChunk);
+    if (affinity == Affinity::None) {
+        omp_set_schedule(omp_sched_dynamic, 1);
+        #pragma omp parallel num_threads(threadCount)
+        cannonTeam();
+    }
+    else if (affinity == Affinity::Compact) {
+        omp_set_schedule(omp_sched_static, 0);
+        #pragma omp parallel num_threads(threadCount) proc_bind(close)
+        cannonTeam();
+    }
+    else {
+        omp_set_schedule(omp_sched_static, 0);
+        #pragma omp parallel num_threads(threadCount) proc_bind(spread)
+        cannonTeam();
+    }
+    omp_set_schedule(callerKind, callerChunk);
+}
+
+// Task-dataflow variant of multiplyOmp. Every block multiply and every
+// block move is an OpenMP task whose depend clauses name the exact A/B/C
+// blocks it touches, so there is no grid-wide barrier between steps: a
+// block starts step s+1 as soon as its own A and B blocks have arrived.
+// Moves go between two generations of each grid and swap the block
+// storage instead of copying it.
+void multiplyOmpTasks(ConstMatrixView matrixA,
+    ConstMatrixView matrixB,
+    MatrixView    matrixC,
+    int           processCount,
+    int           threadCount,
+    const BlockKernel& kernel,
+    BlockFlags&   overflowed)
+{
+    int matrixSize = matrixA.rows;
+
+    // 1) + 2) Grid and block size
+    GridLayout layout = gridLayout(matrixSize, processCount);
+    int gridSize = layout.gridSize;
+    int blockSize = layout.blockSize;
+    if (threadCount <= 0)
+        threadCount = omp_get_num_procs();
+    int zero = semiringZero(kernel.semiring);
+    overflowed.assign(gridSize, vector<char>(gridSize, 0));
+
+    // 3) + 4) Pad and partition, blocks shared among the team;
+    //    generation 1 is the move target
+    Grid gridA[2], gridB[2];
+    for (int g = 0; g < 2; ++g) {
+        gridA[g] = Grid(gridSize, vector<Block>(gridSize));
+        gridB[g] = Grid(gridSize, vector<Block>(gridSize));
+    }
+    #pragma omp parallel for collapse(2) num_threads(threadCount)
+    for (int r = 0; r < gridSize; ++r) {
+        for (int c = 0; c < gridSize; ++c) {
+            loadBlock(matrixA, r, c, blockSize, zero, gridA[0][r][c]);
+            loadBlock(matrixB, r, c, blockSize, zero, gridB[0][r][c]);
+        }
+    }
+
+    Grid blockGridC(gridSize,
+        vector<Block>(gridSize,
+            Block(blockSize, vector<int>(blockSize, zero))));
+
+    #pragma omp parallel num_threads(threadCount)
+    #pragma omp single
+    {
+        int cur = 0;
+        // step -1 is the initial skew (row r left by r, column c up by c),
+        // every later step moves by one
+        for (int step = -1; step < gridSize; ++step) {
+            if (step >= 0) {
+                for (int r = 0; r < gridSize; ++r) {
+                    for (int c = 0; c < gridSize; ++c) {
+                        Block* a = &gridA[cur][r][c];
+                        Block* b = &gridB[cur][r][c];
+                        Block* acc = &blockGridC[r][c];
+                        char* flag = &overflowed[r][c];
+                        #pragma omp task depend(in: *a, *b) depend(inout: *acc)
+                        *flag |= multiplyAcc(*a, *b, *acc, kernel);
+                    }
+                }
+                // the last step's products need no further moves
+                if (step == gridSize - 1) break;
+            }
+            int nxt = 1 - cur;
+            for (int r = 0; r < gridSize; ++r) {
+                for (int c = 0; c < gridSize; ++c) {
+                    int fromCol = (c + (step < 0 ? r : 1)) % gridSize;
+                    Block* srcA = &gridA[cur][r][fromCol];
+                    Block* dstA = &gridA[nxt][r][c];
+                    #pragma omp task depend(inout: *srcA) depend(out: *dstA)
+                    dstA->swap(*srcA);
+
+                    int fromRow = (r + (step < 0 ? c : 1)) % gridSize;
+                    Block* srcB = &gridB[cur][fromRow][c];
+                    Block* dstB = &gridB[nxt][r][c];
+                    #pragma omp task depend(inout: *srcB) depend(out: *dstB)
+                    dstB->swap(*srcB);
+                }
+            }
+            cur = nxt;
+        }
+    }
+
+    // 8) Copy the blocks into C, dropping the padding
+    #pragma omp parallel for collapse(2) num_threads(threadCount)
+    for (int r = 0; r < gridSize; ++r)
+        for (int c = 0; c < gridSize; ++c)
+            storeBlock(blockGridC[r][c], r, c, matrixC);
+}
+
+} // namespace detail
+} // namespace cannon
@@ -0,0 +1,92 @@
+#include <algorithm>   // rotate
+
+#include "cannonGrid.h"
+#include "workStealingPool.h"
+
+using namespace std;
+
+namespace cannon {
+namespace detail {
+
+// Work-stealing variant of the Cannon engines that runs on a caller-owned
+// WorkStealingPool instead of OpenMP. Each step is one parallelFor over
+// the block multiplies followed by one over the row/column rotations.
+// Returns false if the pool was cancelled; matrixC is then unspecified.
+bool multiplyPool(ConstMatrixView matrixA,
+    ConstMatrixView matrixB,
+    MatrixView    matrixC,
+    int           processCount,
+    WorkStealingPool& pool,
+    const BlockKernel& kernel,
+    BlockFlags&   overflowed)
+{
+    int matrixSize = matrixA.rows;
+
+    // 1) + 2) Grid and block size
+    GridLayout layout = gridLayout(matrixSize, processCount);
+    int gridSize = layout.gridSize;
+    int blockSize = layout.blockSize;
+    int zero = semiringZero(kernel.semiring);
+    overflowed.assign(gridSize, vector<char>(gridSize, 0));
+
+    // 3) + 4) Pad and partition, a block per task
+    Grid blockGridA(gridSize, vector<Block>(gridSize));
+    Grid blockGridB(gridSize, vector<Block>(gridSize));
+    if (!pool.parallelFor(gridSize * gridSize, [&](int task) {
+            int r = task / gridSize, c = task % gridSize;
+            loadBlock(matrixA, r, c, blockSize, zero, blockGridA[r][c]);
+            loadBlock(matrixB, r, c, blockSize, zero, blockGridB[r][c]);
+        }))
+        return false;
+    Grid blockGridC(gridSize,
+        vector<Block>(gridSize,
+            Block(blockSize, vector<int>(blockSize, zero))));
+
+    // Tasks 0..gridSize-1 rotate row r of A left, the rest rotate
+    // column c of B up, by r (or c) for the skew and by 1 afterwards
+    auto shiftTask = [&](int task, bool skew) {
+        if (task < gridSize) {
+            int shift = (skew ? task : 1) % gridSize;
+            rotate(blockGridA[task].begin(),
+                blockGridA[task].begin() + shift,
+                blockGridA[task].end());
+            return;
+        }
+        int c = task - gridSize;
+        int shift = (skew ? c : 1) % gridSize;
+        vector<Block> column(gridSize);
+        for (int r = 0; r < gridSize; ++r)
+            column[r].swap(blockGridB[r][c]);
+        rotate(column.begin(), column.begin() + shift, column.end());
+        for (int r = 0; r < gridSize; ++r)
+            blockGridB[r][c].swap(column[r]);
+    };
+
+    // 5) Initial skew
+    if (!pool.parallelFor(2 * gridSize,
+            [&](int task) { shiftTask(task, true); }))
+        return false;
+
+    // 7) gridSize steps of multiply + rotate
+    for (int step = 0; step < gridSize; ++step) {
+        bool finished = pool.parallelFor(gridSize * gridSize, [&](int task) {
+            int r = task / gridSize, c = task % gridSize;
+            overflowed[r][c] |= multiplyAcc(blockGridA[r][c], blockGridB[r][c],
+                blockGridC[r][c], kernel);
+        });
+        if (!finished)
+            return false;
+        if (!pool.parallelFor(2 * gridSize,
+                [&](int task) { shiftTask(task, false); }))
+            return false;
+    }
+
+    // 8) Copy the blocks into C, dropping the padding
+    return pool.parallelFor(gridSize * gridSize, [&](int task) {
+        int r = task / gridSize, c = task % gridSize;
+        storeBlock(blockGridC[r][c], r, c, matrixC);
+    });
+}
+
+} // namespace detail
+} // namespace cannon
@@ -0,0 +1,182 @@
+#include <algorithm>   // rotate, fill, copy, min
+
+#include "cannonGrid.h"
+
+using namespace std;
+
+namespace cannon {
+namespace detail {
+
+// Rotate each row of the block grid left by the amounts in rowShifts
+template <typename BlockT>
+static void shiftBlockRows(vector<vector<BlockT>>& blocks,
+    const vector<int>& rowShifts) {
+    int gridSize = blocks.size();
+    for (int r = 0; r < gridSize; ++r) {
+        int shift = rowShifts[r] % gridSize;
+        if (shift == 0) continue;
+        rotate(blocks[r].begin(),
+            blocks[r].begin() + shift,
+            blocks[r].end());
+    }
+}
+
+// Rotate each column of the block grid up by the amounts in colShifts
+template <typename BlockT>
+static void shiftBlockCols(vector<vector<BlockT>>& blocks,
+    const vector<int>& colShifts) {
+    int gridSize = blocks.size();
+    for (int c = 0; c < gridSize; ++c) {
+        int shift = colShifts[c] % gridSize;
+        if (shift == 0) continue;
+        vector<BlockT> column(gridSize);
+        for (int r = 0; r < gridSize; ++r)
+            column[r] = blocks[r][c];
+        rotate(column.begin(),
+            column.begin() + shift,
+            column.end());
+        for (int r = 0; r < gridSize; ++r)
+            blocks[r][c] = column[r];
+    }
+}
+
+// The same emulation with A and B blocks held as T (int8_t or int16_t),
+// flat and row-major, and flat int C blocks. Entries must already fit T.
+template <typename T>
+static void multiplySerialNarrow(ConstMatrixView matrixA,
+    ConstMatrixView matrixB,
+    MatrixView    matrixC,
+    int           processCount,
+    const KernelTiling& tiling)
+{
+    int matrixSize = matrixA.rows;
+    GridLayout layout = gridLayout(matrixSize, processCount);
+    int gridSize = layout.gridSize;
+    int blockSize = layout.blockSize;
+
+    // 1) Partition straight into narrow blocks, a block row at a time;
+    //    the padding stays zero
+    auto narrowBlocks = [&](ConstMatrixView matrix) {
+        vector<vector<vector<T>>> blocks(gridSize,
+            vector<vector<T>>(gridSize, vector<T>(blockSize * blockSize, 0)));
+        for (int r = 0; r < matrixSize; ++r) {
+            for (int blockCol = 0; blockCol < gridSize; ++blockCol) {
+                int colBegin = blockCol * blockSize;
+                int width = min(blockSize, matrixSize - colBegin);
+                if (width <= 0) break;
+                const int* from = &matrix(r, colBegin);
+                copy(from, from + width,
+                    blocks[r / blockSize][blockCol].begin()
+                        + (r % blockSize) * blockSize);
+            }
+        }
+        return blocks;
+    };
+    vector<vector<vector<T>>> blockGridA = narrowBlocks(matrixA);
+    vector<vector<vector<T>>> blockGridB = narrowBlocks(matrixB);
+
+    // 2) Initial skew: row i left by i, column j up by j
+    vector<int> rowShifts(gridSize), colShifts(gridSize);
+    for (int i = 0; i < gridSize; ++i) {
+        rowShifts[i] = i;
+        colShifts[i] = i;
+    }
+    shiftBlockRows(blockGridA, rowShifts);
+    shiftBlockCols(blockGridB, colShifts);
+
+    // 3) gridSize steps of multiply + rotate into zeroed int C blocks
+    vector<vector<vector<int>>> blockGridC(gridSize,
+        vector<vector<int>>(gridSize, vector<int>(blockSize * blockSize, 0)));
+    fill(rowShifts.begin(), rowShifts.end(), 1);
+    fill(colShifts.begin(), colShifts.end(), 1);
+    for (int step = 0; step < gridSize; ++step) {
+        for (int r = 0; r < gridSize; ++r)
+            for (int c = 0; c < gridSize; ++c)
+                multiplyAccFlat<PlusTimes>(blockGridA[r][c].data(),
+                    blockGridB[r][c].data(), blockGridC[r][c].data(),
+                    blockSize, 0, blockSize, tiling);
+        shiftBlockRows(blockGridA, rowShifts);
+        shiftBlockCols(blockGridB, colShifts);
+    }
+
+    // 4) Copy the unpadded part of C out of the blocks
+    for (int r = 0; r < matrixSize; ++r) {
+        for (int blockCol = 0; blockCol < gridSize; ++blockCol) {
+            int colBegin = blockCol * blockSize;
+            int width = min(blockSize, matrixSize - colBegin);
+            if (width <= 0) break;
+            const int* from = blockGridC[r / blockSize][blockCol].data()
+                + (r % blockSize) * blockSize;
+            copy(from, from + width, &matrixC(r, colBegin));
+        }
+    }
+}
+
+// Cannon multiplication emulation: computes A x B = C
+// using processCount virtual processes, padding as needed
+void multiplySerial(ConstMatrixView matrixA,
+    ConstMatrixView matrixB,
+    MatrixView    matrixC,
+    int           processCount,
+    const BlockKernel& kernel,
+    Precision     precision,
+    BlockFlags&   overflowed)
+{
+    overflowed.clear();
+    if (precision == Precision::Int16)
+        return multiplySerialNarrow<int16_t>(matrixA, matrixB, matrixC,
+            processCount, kernel.tiling);
+    if (precision == Precision::Int8)
+        return multiplySerialNarrow<int8_t>(matrixA, matrixB, matrixC,
+            processCount, kernel.tiling);
+    int zero = semiringZero(kernel.semiring);
+
+    int matrixSize = matrixA.rows;
+
+    // 1) + 2) Grid and block size
+    GridLayout layout = gridLayout(matrixSize, processCount);
+    int gridSize = layout.gridSize;
+    int blockSize = layout.blockSize;
+    overflowed.assign(gridSize, vector<char>(gridSize, 0));
+
+    // 3) + 4) Partition into blocks, padded with the semiring's zero
+    Grid blockGridA = makeBlocks(matrixA, gridSize, blockSize, zero);
+    Grid blockGridB = makeBlocks(matrixB, gridSize, blockSize, zero);
+
+    // 5) Initial skew: row i left by i, column j up by j
+    vector<int> rowShifts(gridSize), colShifts(gridSize);
+    for (int i = 0; i < gridSize; ++i) {
+        rowShifts[i] = i;
+        colShifts[i] = i;
+    }
+    shiftBlockRows(blockGridA, rowShifts);
+    shiftBlockCols(blockGridB, colShifts);
+
+    // 6) Allocate zeroed C blocks
+    Grid blockGridC(gridSize,
+        vector<Block>(gridSize,
+            Block(blockSize, vector<int>(blockSize, zero))));
+
+    // 7) gridSize steps of multiply + rotate
+    for (int step = 0; step < gridSize; ++step) {
+        // local multiply-accumulate
+        for (int r = 0; r < gridSize; ++r) {
+            for (int c = 0; c < gridSize; ++c) {
+                overflowed[r][c] |= multiplyAcc(blockGridA[r][c],
+                    blockGridB[r][c],
+                    blockGridC[r][c], kernel);
+            }
+        }
+        // rotate each row/column by 1 for next step
+        fill(rowShifts.begin(), rowShifts.end(), 1);
+        fill(colShifts.begin(), colShifts.end(), 1);
+        shiftBlockRows(blockGridA, rowShifts);
+        shiftBlockCols(blockGridB, colShifts);
+    }
+
+    // 8) Copy the blocks into C, dropping the padding
+    assemble(blockGridC, matrixC);
+}
+
+} // namespace detail
+} // namespace cannon
@@ -0,0 +1,302 @@
+#include "cannonTuning.h"
+
+#include <algorithm>   // min_element, replace
+#include <chrono>
+#include <cmath>       // fabs, log
+#include <cstdlib>     // rand, getenv, abs
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>      // hardware_concurrency
+#include <vector>
+
+#include "cannonGrid.h"
+#include "workStealingPool.h"
+
+using namespace std;
+
+namespace cannon {
+
+using namespace detail;
+
+namespace {
+
+struct KernelEntry {
+    string       cpu;
+    int          blockSize;
+    KernelTiling tiling;
+};
+
+struct LayoutEntry {
+    string cpu;
+    string engine;
+    int    n;
+    int    processCount;
+    int    threadCount;
+};
+
+struct TuningFile {
+    vector<KernelEntry> kernels;
+    vector<LayoutEntry> layouts;
+};
+
+// Parsed tuning files by path, so each file is read once per process
+mutex cacheLock;
+map<string, TuningFile> cache;
+
+const char* engineName(Engine engine)
+{
+    switch (engine) {
+    case Engine::Serial:      return "serial";
+    case Engine::OpenMP:      return "openmp";
+    case Engine::OpenMPTasks: return "openmp-tasks";
+    case Engine::Pool:        return "pool";
+    }
+    return "unknown";
+}
+
+// Caller holds cacheLock
+TuningFile& cachedFile(const string& path)
+{
+    auto found = cache.find(path);
+    if (found != cache.end())
+        return found->second;
+
+    TuningFile& file = cache[path];
+    ifstream in(path);
+    string line;
+    while (getline(in, line)) {
+        istringstream fields(line);
+        string kind;
+        fields >> kind;
+        if (kind == "kernel") {
+            KernelEntry entry;
+            if (fields >> entry.cpu >> entry.blockSize >> entry.tiling.rows
+                    >> entry.tiling.inner >> entry.tiling.cols)
+                file.kernels.push_back(entry);
+        }
+        else if (kind == "layout") {
+            LayoutEntry entry;
+            if (fields >> entry.cpu >> entry.engine >> entry.n
+                    >> entry.processCount >> entry.threadCount)
+                file.layouts.push_back(entry);
+        }
+    }
+    return file;
+}
+
+// Caller holds cacheLock
+void writeFile(const string& path, const TuningFile& file)
+{
+    ofstream out(path, ios::trunc);
+    for (const KernelEntry& entry : file.kernels)
+        out << "kernel " << entry.cpu << ' ' << entry.blockSize << ' '
+            << entry.tiling.rows << ' ' << entry.tiling.inner << ' '
+            << entry.tiling.cols << '\n';
+    for (const LayoutEntry& entry : file.layouts)
+        out << "layout " << entry.cpu << ' ' << entry.engine << ' '
+            << entry.n << ' ' << entry.processCount << ' '
+            << entry.threadCount << '\n';
+}
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+string cpuModel()
+{
+    static const string model = [] {
+        ifstream cpuinfo("/proc/cpuinfo");
+        string line;
+        while (getline(cpuinfo, line)) {
+            if (line.compare(0, 10, "model name") != 0)
+                continue;
+            size_t colon = line.find(':');
+            string name = colon == string::npos ? "" : line.substr(colon + 1);
+            name.erase(0, name.find_first_not_of(' '));
+            replace(name.begin(), name.end(), ' ', '_');
+            replace(name.begin(), name.end(), '\t', '_');
+            if (!name.empty())
+                return name;
+        }
+        return string("unknown");
+    }();
+    return model;
+}
+
+string defaultTuningFile()
+{
+    const char* path = getenv("CANNON_TUNING_FILE");
+    return path && *path ? path : "cannon_tuning.txt";
+}
+
+bool loadKernelTiling(const string& path, int blockSize, KernelTiling& tiling)
+{
+    lock_guard<mutex> guard(cacheLock);
+    const TuningFile& file = cachedFile(path);
+    const KernelEntry* best = nullptr;
+    for (const KernelEntry& entry : file.kernels) {
+        if (entry.cpu != cpuModel())
+            continue;
+        if (!best || abs(entry.blockSize - blockSize) < abs(best->blockSize - blockSize))
+            best = &entry;
+    }
+    if (best)
+        tiling = best->tiling;
+    return best != nullptr;
+}
+
+bool loadLayout(const string& path, Engine engine, int n,
+    int& processCount, int& threadCount)
+{
+    lock_guard<mutex> guard(cacheLock);
+    const TuningFile& file = cachedFile(path);
+    const LayoutEntry* best = nullptr;
+    double bestDistance = log(2.0);
+    for (const LayoutEntry& entry : file.layouts) {
+        if (entry.cpu != cpuModel() || entry.engine != engineName(engine))
+            continue;
+        double distance = fabs(log(double(entry.n) / n));
+        if (distance <= bestDistance) {
+            bestDistance = distance;
+            best = &entry;
+        }
+    }
+    if (best) {
+        processCount = best->processCount;
+        threadCount = best->threadCount;
+    }
+    return best != nullptr;
+}
+
+KernelTiling autotuneKernel(int blockSize, const string& path)
+{
+    Block A(blockSize, vector<int>(blockSize)), B = A;
+    for (int i = 0; i < blockSize; ++i)
+        for (int j = 0; j < blockSize; ++j) {
+            A[i][j] = rand() % 20;
+            B[i][j] = rand() % 20;
+        }
+
+    // tiles at least as large as the block are the same as untiled
+    vector<BlockKernel> candidates;
+    for (int rows : { 0, 4, 16, 64 })
+        for (int inner : { 0, 64, 256 })
+            for (int cols : { 0, 256, 1024 }) {
+                if (rows >= blockSize || inner >= blockSize || cols >= blockSize)
+                    continue;
+                BlockKernel kernel;
+                kernel.tiling.rows = rows;
+                kernel.tiling.inner = inner;
+                kernel.tiling.cols = cols;
+                candidates.push_back(kernel);
+            }
+
+    // enough repetitions for roughly 10^8 multiply-adds per measurement
+    double work = double(blockSize) * blockSize * blockSize;
+    int repetitions = int(max(1.0, 1e8 / work));
+
+    KernelTiling best;
+    double bestSeconds = -1;
+    for (const BlockKernel& kernel : candidates) {
+        Block C(blockSize, vector<int>(blockSize, 0));
+        auto start = chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep)
+            multiplyAcc(A, B, C, kernel);
+        double seconds = secondsSince(start);
+        if (bestSeconds < 0 || seconds < bestSeconds) {
+            bestSeconds = seconds;
+            best = kernel.tiling;
+        }
+    }
+
+    lock_guard<mutex> guard(cacheLock);
+    TuningFile& file = cachedFile(path);
+    auto& kernels = file.kernels;
+    kernels.erase(remove_if(kernels.begin(), kernels.end(),
+        [&](const KernelEntry& entry) {
+            return entry.cpu == cpuModel() && entry.blockSize == blockSize;
+        }), kernels.end());
+    kernels.push_back({ cpuModel(), blockSize, best });
+    writeFile(path, file);
+    return best;
+}
+
+Tuning autotune(int n, const Options& options, const string& path)
+{
+    int cores = max(1u, thread::hardware_concurrency());
+    vector<int> threadCandidates = { 1 };
+    if (options.engine != Engine::Serial) {
+        if (cores / 2 > 1)
+            threadCandidates.push_back(cores / 2);
+        if (cores > 1)
+            threadCandidates.push_back(cores);
+    }
+    // square grids up to 16 x 16, keeping blocks at least 16 wide
+    vector<int> processCandidates;
+    for (int g = 1; g <= 16 && (g == 1 || (n + g - 1) / g >= 16); ++g)
+        processCandidates.push_back(g * g);
+
+    vector<int> matrixA(size_t(n) * n), matrixB(size_t(n) * n), matrixC(size_t(n) * n);
+    for (size_t i = 0; i < matrixA.size(); ++i) {
+        matrixA[i] = rand() % 20;
+        matrixB[i] = rand() % 20;
+    }
+
+    map<int, KernelTiling> kernelFor;
+    Tuning best;
+    double bestSeconds = -1;
+    for (int processCount : processCandidates) {
+        int blockSize = gridLayout(n, processCount).blockSize;
+        if (!kernelFor.count(blockSize))
+            kernelFor[blockSize] = autotuneKernel(blockSize, path);
+
+        for (int threadCount : threadCandidates) {
+            Options candidate = options;
+            candidate.processCount = processCount;
+            candidate.threadCount = threadCount;
+            candidate.tiling = kernelFor[blockSize];
+            candidate.tuningFile.clear();
+            unique_ptr<WorkStealingPool> pool;
+            if (options.engine == Engine::Pool) {
+                pool.reset(new WorkStealingPool(threadCount));
+                candidate.pool = pool.get();
+            }
+
+            // best of two, the first run also warms the caches
+            for (int rep = 0; rep < 2; ++rep) {
+                auto start = chrono::steady_clock::now();
+                multiply(ConstMatrixView(matrixA.data(), n),
+                    ConstMatrixView(matrixB.data(), n),
+                    MatrixView(matrixC.data(), n), candidate);
+                double seconds = secondsSince(start);
+                if (bestSeconds < 0 || seconds < bestSeconds) {
+                    bestSeconds = seconds;
+                    best.processCount = processCount;
+                    best.threadCount = threadCount;
+                    best.tiling = candidate.tiling;
+                }
+            }
+        }
+    }
+
+    lock_guard<mutex> guard(cacheLock);
+    TuningFile& file = cachedFile(path);
+    auto& layouts = file.layouts;
+    layouts.erase(remove_if(layouts.begin(), layouts.end(),
+        [&](const LayoutEntry& entry) {
+            return entry.cpu == cpuModel() && entry.engine == engineName(options.engine)
+                && entry.n == n;
+        }), layouts.end());
+    layouts.push_back({ cpuModel(), engineName(options.engine), n,
+        best.processCount, best.threadCount });
+    writeFile(path, file);
+    return best;
+}
+
+} // namespace cannon
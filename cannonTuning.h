@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+
+#include "cannon.h"
+
+// Autotuning and the persisted tuning file.
+//
+// The file is plain text, one winner per line, keyed by CPU model:
+//   kernel <cpu> <blockSize> <rows> <inner> <cols>
+//   layout <cpu> <engine> <n> <processCount> <threadCount>
+// (spaces in the CPU model are written as '_'). Kernel tilings are looked
+// up by the nearest tuned block size; layouts need the same engine and an
+// n within a factor of two of a tuned one.
+namespace cannon {
+
+// A tuned configuration for one engine and problem size
+struct Tuning {
+    int          processCount = 1;
+    int          threadCount = 0;
+    KernelTiling tiling;
+};
+
+// "model name" of this CPU, as used in the tuning file
+std::string cpuModel();
+
+// $CANNON_TUNING_FILE, or cannon_tuning.txt in the working directory
+std::string defaultTuningFile();
+
+// Look up tuned values for this CPU; false if the file has none that fit
+bool loadKernelTiling(const std::string& path, int blockSize, KernelTiling& tiling);
+bool loadLayout(const std::string& path, Engine engine, int n,
+    int& processCount, int& threadCount);
+
+// Benchmark candidate tilings of the b x b local block multiply, store
+// the fastest in path and return it
+KernelTiling autotuneKernel(int blockSize, const std::string& path);
+
+// Benchmark candidate process grids and thread counts (each with its own
+// tuned kernel tiling) for n x n products on options.engine, store the
+// fastest in path and return it. Engine::Pool candidates get a pool of
+// their own; options.pool is not used.
+Tuning autotune(int n, const Options& options, const std::string& path);
+
+} // namespace cannon
@@ -3,6 +3,10 @@
 #include <vector>
 #include <cmath>
 #include <chrono>      // system_clock
+#include <cstdlib>     // getenv
+
+#include "cannonMpi.h"
+#include "cannonTuning.h"
 
 using namespace std;
 
@@ -23,36 +27,18 @@ int main(int argc, char **argv)
         MPI_Abort(MPI_COMM_WORLD, -1);
     }
 
-    // 2) Build a 2D Cartesian communicator, periodic in both dims
-    MPI_Comm comm2d;
-    int dims[2] = {q, q};
-    int periods[2] = {1, 1}; // wraparound
-    MPI_Cart_create(MPI_COMM_WORLD, 2, dims, periods, 1, &comm2d);
-
-    // Get my coords in the grid
-    int coords[2];
-    MPI_Cart_coords(comm2d, rank, 2, coords);
-    int myRow = coords[0], myCol = coords[1];
-
-    // 3) Root reads n, broadcasts to all
-    int n;
+    // 2) Root reads n and the matrices; the library broadcasts n.
+    //    Random runs may ask for a batch of independent products
+    int n = 0, batchSize = 1, concurrent = 0;
+    bool compress = false;
+    int checkpointEvery = 0;
+    bool restart = false, abft = false, nodeAware = true;
+    cannon::Precision precision = cannon::Precision::Int32;
+    std::vector<int> Aflat, Bflat, Cflat;
     if (rank == 0)
     {
         std::cout << "Enter matrix dimension n: ";
         std::cin >> n;
-    }
-    MPI_Bcast(&n, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-    // 4) Compute blockSize and padded size
-    int blockSize = (n + q - 1) / q; // = ceil(n / q)
-    int nPadded = q * blockSize;     // padded dimension
-
-    // 5) Allocate and (on root) read + pad A and B
-    std::vector<int> Aflat, Bflat;
-    if (rank == 0)
-    {
-        Aflat.assign(nPadded * nPadded, 0);
-        Bflat.assign(nPadded * nPadded, 0);
 
         char randChoice;
         std::cout << "Randomize matrices(y/n)\n";
@@ -60,151 +46,143 @@ int main(int argc, char **argv)
 
         if (randChoice == 'y' || randChoice == 'Y')
         {
-            srand(time(0));
-            for (int i = 0; i < n; ++i)
+            std::cout << "How many products in the batch? ";
+            std::cin >> batchSize;
+            if (batchSize < 1)
+                batchSize = 1;
+            if (batchSize > 1)
             {
-                for (int j = 0; j < n; ++j)
-                {
-                    Aflat[i * nPadded + j] = rand() % 20;
-                }
+                char concurrentChoice;
+                std::cout << "Run them on concurrent sub-grids? (y/n) ";
+                std::cin >> concurrentChoice;
+                concurrent = (concurrentChoice == 'y' || concurrentChoice == 'Y');
             }
-            for (int i = 0; i < n; ++i)
+            // random entries are 0..19, so they fit in a byte
+            char narrowChoice;
+            std::cout << "Send blocks as 8-bit integers? (y/n) ";
+            std::cin >> narrowChoice;
+            if (narrowChoice == 'y' || narrowChoice == 'Y')
+                precision = cannon::Precision::Int8;
+            char compressChoice;
+            std::cout << "Bit-pack shifted blocks? (y/n) ";
+            std::cin >> compressChoice;
+            compress = (compressChoice == 'y' || compressChoice == 'Y');
+        }
+        // checkpoints and checksums are for plain shifts on the whole grid
+        if (!concurrent && !compress)
+        {
+            std::cout << "Checkpoint every how many Cannon steps? (0 for never) ";
+            std::cin >> checkpointEvery;
+            if (checkpointEvery > 0)
             {
-                for (int j = 0; j < n; ++j)
-                {
+                char restartChoice;
+                std::cout << "Resume from the last checkpoint? (y/n) ";
+                std::cin >> restartChoice;
+                restart = (restartChoice == 'y' || restartChoice == 'Y');
+            }
+            if (precision == cannon::Precision::Int32)
+            {
+                char abftChoice;
+                std::cout << "Check C blocks against checksums every step? (y/n) ";
+                std::cin >> abftChoice;
+                abft = (abftChoice == 'y' || abftChoice == 'Y');
+            }
+        }
+        // anything but no keeps the placement on
+        char nodeChoice;
+        std::cout << "Keep ranks of one node on one tile of the grid? (y/n) ";
+        std::cin >> nodeChoice;
+        nodeAware = !(nodeChoice == 'n' || nodeChoice == 'N');
 
-                    Bflat[i * nPadded + j] = rand() % 20;
-                }
+        Aflat.assign(batchSize * n * n, 0);
+        Bflat.assign(batchSize * n * n, 0);
+        Cflat.assign(batchSize * n * n, 0);
+
+        if (randChoice == 'y' || randChoice == 'Y')
+        {
+            // a run that checkpoints must draw the same matrices again
+            // when it is restarted
+            srand(checkpointEvery > 0 ? 1 : time(0));
+            for (int i = 0; i < batchSize * n * n; ++i)
+            {
+                Aflat[i] = rand() % 20;
+            }
+            for (int i = 0; i < batchSize * n * n; ++i)
+            {
+                Bflat[i] = rand() % 20;
             }
         }
         else
         {
             std::cout << "Enter matrix A (" << n << "x" << n << "):\n";
-            for (int i = 0; i < n; ++i)
+            for (int i = 0; i < n * n; ++i)
             {
-                for (int j = 0; j < n; ++j)
-                {
-                    int x;
-                    std::cin >> x;
-                    Aflat[i * nPadded + j] = x;
-                }
+                std::cin >> Aflat[i];
             }
             std::cout << "Enter matrix B (" << n << "x" << n << "):\n";
-            for (int i = 0; i < n; ++i)
+            for (int i = 0; i < n * n; ++i)
             {
-                for (int j = 0; j < n; ++j)
-                {
-                    int x;
-                    std::cin >> x;
-                    Bflat[i * nPadded + j] = x;
-                }
+                std::cin >> Bflat[i];
             }
         }
     }
-
-    // 6) Allocate local blocks and result block
-    std::vector<int> Ablock(blockSize * blockSize),
-        Bblock(blockSize * blockSize),
-        Cblock(blockSize * blockSize, 0);
-
-    // 7) Create MPI datatype for a blockSize x blockSize submatrix
-    MPI_Datatype blockType;
-    MPI_Type_vector(blockSize, blockSize, nPadded, MPI_INT, &blockType);
-    MPI_Type_create_resized(blockType, 0, sizeof(int), &blockType);
-    MPI_Type_commit(&blockType);
-
-    // 8) Compute displacements for Scatterv/Gatherv
-    std::vector<int> displs(P), counts(P, 1);
-    if (rank == 0)
+    std::vector<cannon::ConstMatrixView> As, Bs;
+    std::vector<cannon::MatrixView> Cs;
+    for (int b = 0; b < batchSize; ++b)
     {
-        for (int i = 0; i < q; ++i)
-        {
-            for (int j = 0; j < q; ++j)
-            {
-                displs[i * q + j] = i * nPadded * blockSize + j * blockSize;
-            }
-        }
+        As.emplace_back(Aflat.data() + b * n * n, n);
+        Bs.emplace_back(Bflat.data() + b * n * n, n);
+        Cs.emplace_back(Cflat.data() + b * n * n, n);
     }
 
+    // 3) Grid setup, then scatter, skew, q Cannon steps and gather for
+    //    every product, all in the library; either the whole grid takes
+    //    the products in turn or they run side by side on sub-grids
+    MPI_Bcast(&concurrent, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    // each rank takes the kernel tiling tuned for its own CPU, if any
+    cannon::MpiOptions options;
+    options.tuningFile = cannon::defaultTuningFile();
+    options.precision = precision;   // only root's is used
+    // keep most block shifts between ranks of one node; only root's is used
+    options.nodeAware = nodeAware;
+    // the cost model assumes a 10 Gbit/s link between ranks
+    if (compress)
+        options.compressBytesPerSecond = 1.25e9;
+    // only root's checkpoint settings are used; each rank writes to its
+    // own node's scratch directory
+    options.checkpointEvery = checkpointEvery;
+    options.restart = restart;
+    options.abft = abft;
+    const char* scratch = std::getenv("TMPDIR");
+    options.checkpointDir = scratch ? scratch : "/tmp";
     auto start = chrono::high_resolution_clock::now();
-    // 9) Scatter the blocks of A and B
-    MPI_Scatterv(
-        Aflat.data(), counts.data(), displs.data(), blockType,
-        Ablock.data(), blockSize * blockSize, MPI_INT,
-        0, comm2d);
-    MPI_Scatterv(
-        Bflat.data(), counts.data(), displs.data(), blockType,
-        Bblock.data(), blockSize * blockSize, MPI_INT,
-        0, comm2d);
-
-
-    // 10) Initial alignment ("skew")
-    MPI_Status status;
-    int src, dst;
-    // 10a) Shift A left by myRow steps
-    MPI_Cart_shift(comm2d, 1, -1, &src, &dst);
-    for (int i = 0; i < myRow; ++i)
-    {
-        MPI_Sendrecv_replace(
-            Ablock.data(), blockSize * blockSize, MPI_INT,
-            dst, 0, src, 0, comm2d, &status);
-    }
-    // 10b) Shift B up by myCol steps
-    MPI_Cart_shift(comm2d, 0, -1, &src, &dst);
-    for (int i = 0; i < myCol; ++i)
+    if (concurrent)
     {
-        MPI_Sendrecv_replace(
-            Bblock.data(), blockSize * blockSize, MPI_INT,
-            dst, 0, src, 0, comm2d, &status);
-    }
-
-    // 11) The main Cannon loop
-    for (int step = 0; step < q; ++step)
-    {
-        // 11a) Local multiply-accumulate
-        for (int i = 0; i < blockSize; ++i)
+        std::vector<cannon::Product> products;
+        for (int b = 0; b < batchSize; ++b)
         {
-            for (int k = 0; k < blockSize; ++k)
-            {
-                int a = Ablock[i * blockSize + k];
-                for (int j = 0; j < blockSize; ++j)
-                {
-                    Cblock[i * blockSize + j] +=
-                        a * Bblock[k * blockSize + j];
-                }
-            }
+            products.push_back({ As[b], Bs[b], Cs[b] });
         }
-        // 11b) Shift A one step left
-        MPI_Cart_shift(comm2d, 1, -1, &src, &dst);
-        MPI_Sendrecv_replace(
-            Ablock.data(), blockSize * blockSize, MPI_INT,
-            dst, 0, src, 0, comm2d, &status);
-        // 11c) Shift B one step up
-        MPI_Cart_shift(comm2d, 0, -1, &src, &dst);
-        MPI_Sendrecv_replace(
-            Bblock.data(), blockSize * blockSize, MPI_INT,
-            dst, 0, src, 0, comm2d, &status);
+        cannon::multiplyConcurrent(products, MPI_COMM_WORLD,
+            cannon::GridCostModel(), options);
     }
-
-
-    // 12) Gather Cblocks back to root into paddedCflat
-    std::vector<int> paddedCflat;
-    if (rank == 0)
+    else
     {
-        paddedCflat.assign(nPadded * nPadded, 0);
+        // scoped so the grid is freed before MPI_Finalize
+        cannon::MpiBatch batch(n, MPI_COMM_WORLD, options);
+        batch.multiply(As, Bs, Cs);
+        if (rank == 0 && batch.failedCheckpoints() > 0)
+            std::cerr << "Warning: " << batch.failedCheckpoints()
+                << " checkpoints could not be written\n";
     }
-    MPI_Gatherv(
-        Cblock.data(), blockSize * blockSize, MPI_INT,
-        paddedCflat.data(), counts.data(), displs.data(), blockType,
-        0, comm2d);
-
     auto stop = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::milliseconds>(stop - start);
-    
+
     if(rank == 0){
         std::cout << "Duration is " << duration.count() << " milliseconds\n";
     }
-    // 13) Root prints only the top-left n x n of paddedCflat
+    // 4) Root prints the first product's C
+    // cannon::MatrixView C = Cs[0];
     // if (rank == 0)
     // {
     //     std::cout << "Result C = A x B:\n";
@@ -212,14 +190,12 @@ int main(int argc, char **argv)
     //     {
     //         for (int j = 0; j < n; ++j)
     //         {
-    //             std::cout << paddedCflat[i * nPadded + j] << ' ';
+    //             std::cout << C(i, j) << ' ';
     //         }
     //         std::cout << '\n';
     //     }
     // }
 
-    MPI_Type_free(&blockType);
-    MPI_Comm_free(&comm2d);
     MPI_Finalize();
     return 0;
-}
\ No newline at end of file
+}
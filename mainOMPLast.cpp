@@ -1,246 +1,31 @@
 #include <iostream>
 #include <vector>
-#include <algorithm>   // rotate, fill
 #include <cmath>       // sqrt, ceil, floor
 #include <iomanip>     // setw
 #include <chrono>      // system_clock
 #include <omp.h>
 //#include <random>      // mt19937, uniform_int_distribution
 
+#include "cannon.h"
+#include "cannonTuning.h"
+#include "workStealingPool.h"
+
 using namespace std;
 
 #define PRINT_MAT 0
 
-// A Block is a blockSize x blockSize matrix of ints
-using Block = vector<vector<int>>;
-// A Grid is gridSize rows of gridSize Blocks
-using Grid = vector<vector<Block>>;
-
 // Print an N x N matrix
-void printMatrix(const vector<vector<int>>& matrix) {
-    int N = matrix.size();
+void printMatrix(cannon::ConstMatrixView matrix) {
+    int N = matrix.rows;
     for (int r = 0; r < N; ++r) {
         for (int c = 0; c < N; ++c) {
-            cout << setw(6) << matrix[r][c];
+            cout << setw(6) << matrix(r, c);
         }
         cout << "\n";
     }
     cout << "\n";
 }
 
-// Pad an N x N matrix up to paddedSize x paddedSize with zeros
-vector<vector<int>> padMatrix(const vector<vector<int>>& matrix,
-    int paddedSize) {
-    int N = matrix.size();
-    vector<vector<int>> result(paddedSize, vector<int>(paddedSize, 0));
-    for (int r = 0; r < N; ++r)
-        for (int c = 0; c < N; ++c)
-            result[r][c] = matrix[r][c];
-    return result;
-}
-
-// Break an N x N matrix into gridSize rows of gridSize blocks,
-// each block is blockSize x blockSize
-Grid makeBlocks(const vector<vector<int>>& matrix,
-    int gridSize,
-    int blockSize)
-{
-    int N = matrix.size();
-    Grid blocks(gridSize,
-        vector<Block>(gridSize,
-            Block(blockSize, vector<int>(blockSize, 0))));
-    for (int r = 0; r < N; ++r) {
-        for (int c = 0; c < N; ++c) {
-            int blockRow = r / blockSize;
-            int blockCol = c / blockSize;
-            int inBlockRow = r % blockSize;
-            int inBlockCol = c % blockSize;
-            blocks[blockRow][blockCol][inBlockRow][inBlockCol]
-                = matrix[r][c];
-        }
-    }
-    return blocks;
-}
-
-// Reassemble gridSize rows of gridSize blocks,
-// each blockSize x blockSize, into one big matrix
-vector<vector<int>> assemble(const Grid& blocks) {
-    int gridSize = blocks.size();
-    int blockSize = blocks[0][0].size();
-    int N = gridSize * blockSize;
-    vector<vector<int>> matrix(N, vector<int>(N, 0));
-    for (int r = 0; r < N; ++r) {
-        for (int c = 0; c < N; ++c) {
-            int blockRow = r / blockSize;
-            int blockCol = c / blockSize;
-            int inBlockRow = r % blockSize;
-            int inBlockCol = c % blockSize;
-            matrix[r][c]
-                = blocks[blockRow][blockCol][inBlockRow][inBlockCol];
-        }
-    }
-    return matrix;
-}
-
-// Rotate each row of the block grid left by the amounts in rowShifts
-void shiftBlockRows(Grid& blocks,
-    const vector<int>& rowShifts) {
-    int gridSize = blocks.size();
-
-    #pragma omp parallel for
-    for (int r = 0; r < gridSize; ++r) {
-        int shift = rowShifts[r] % gridSize;
-        if (shift == 0) continue;
-        rotate(blocks[r].begin(),
-            blocks[r].begin() + shift,
-            blocks[r].end());
-    }
-}
-
-// Rotate each column of the block grid up by the amounts in colShifts
-void shiftBlockCols(Grid& blocks,
-    const vector<int>& colShifts) {
-    int gridSize = blocks.size();
-
-    #pragma omp parallel for
-    for (int c = 0; c < gridSize; ++c) {
-        int shift = colShifts[c] % gridSize;
-        if (shift == 0) continue;
-        vector<Block> column(gridSize);
-
-        for (int r = 0; r < gridSize; ++r)
-            column[r] = blocks[r][c];
-        rotate(column.begin(),
-            column.begin() + shift,
-            column.end());
-        for (int r = 0; r < gridSize; ++r)
-            blocks[r][c] = column[r];
-    }
-}
-
-// Multiply two blockSize x blockSize blocks A and B into C
-void multiplyAcc(const Block& A,
-    const Block& B,
-    Block& C)
-{
-    int blockSize = A.size();
-    for (int i = 0; i < blockSize; ++i)
-        for (int k = 0; k < blockSize; ++k)
-            for (int j = 0; j < blockSize; ++j)
-                C[i][j] += A[i][k] * B[k][j];
-}
-
-// Cannon multiplication emulation: computes A x B = C
-// using processCount virtual processes, padding as needed
-void cannonMultiply(const vector<vector<int>>& matrixA,
-    const vector<vector<int>>& matrixB,
-    vector<vector<int>>& matrixC,
-    int                        processCount)
-{
-    int matrixSize = matrixA.size();
-
-    // 1) Determine gridSize: if processCount is a perfect square,
-    //    use exact sqrt; otherwise ceil(sqrt)
-    double sqrtP = sqrt(double(processCount));
-    int    nearestRoot = int(floor(sqrtP + 0.5));
-    bool   isSquare = (nearestRoot * nearestRoot == processCount);
-    int    gridSize = isSquare ? nearestRoot
-        : int(ceil(sqrtP));
-
-    // 2) Determine blockSize so gridSize*blockSize >= matrixSize
-    bool dividesEvenly = (matrixSize % gridSize == 0);
-    int  blockSize = dividesEvenly
-        ? matrixSize / gridSize
-        : int(ceil(double(matrixSize) / gridSize));
-    int  paddedSize = gridSize * blockSize;
-
-    // 3) Pad A and B if needed
-    vector<vector<int>> paddedA = (isSquare && dividesEvenly)
-        ? matrixA
-        : padMatrix(matrixA, paddedSize);
-    vector<vector<int>> paddedB = (isSquare && dividesEvenly)
-        ? matrixB
-        : padMatrix(matrixB, paddedSize);
-
-    // 4) Partition into blocks
-    Grid blockGridA = makeBlocks(paddedA, gridSize, blockSize);
-    Grid blockGridB = makeBlocks(paddedB, gridSize, blockSize);
-
-    // 5) Initial skew: row i left by i, column j up by j
-    vector<int> rowShifts(gridSize), colShifts(gridSize);
-    for (int i = 0; i < gridSize; ++i) {
-        rowShifts[i] = i;
-        colShifts[i] = i;
-    }
-    #pragma omp parallel
-    {
-
-        #pragma omp sections
-        {
-
-            #pragma omp section
-            {
-                shiftBlockRows(blockGridA, rowShifts);
-            }
-
-            #pragma omp section
-            {
-                shiftBlockCols(blockGridB, colShifts);
-            }
-        }
-
-    }
-
-    // 6) Allocate zeroed C blocks
-    Grid blockGridC(gridSize,
-        vector<Block>(gridSize,
-            Block(blockSize, vector<int>(blockSize, 0))));
-
-    // 7) gridSize steps of multiply + rotate
-
-
-    for (int step = 0; step < gridSize; ++step) {
-        // local multiply-accumulate
-        #pragma omp parallel for collapse(2)
-        for (int r = 0; r < gridSize; ++r) {
-            for (int c = 0; c < gridSize; ++c) {
-                multiplyAcc(blockGridA[r][c],
-                    blockGridB[r][c],
-                    blockGridC[r][c]);
-            }
-        }
-        // rotate each row/column by 1 for next step
-        fill(rowShifts.begin(), rowShifts.end(), 1);
-        fill(colShifts.begin(), colShifts.end(), 1);
-        #pragma omp parallel
-        {
-
-            #pragma omp sections
-            {
-
-                #pragma omp section
-                {
-                    shiftBlockRows(blockGridA, rowShifts);
-                }
-
-                #pragma omp section
-                {
-                    shiftBlockCols(blockGridB, colShifts);
-                }
-            }
-
-        }
-    }
-
-    // 8) Reassemble and trim to original size
-    vector<vector<int>> paddedC = assemble(blockGridC);
-    for (int r = 0; r < matrixSize; ++r) {
-        for (int c = 0; c < matrixSize; ++c) {
-            matrixC[r][c] = paddedC[r][c];
-        }
-    }
-}
-
 int main() {
     int matrixSize;
     cout << "Matrix dimension n: ";
@@ -254,31 +39,35 @@ int main() {
     char randomizeChoice;
     cin >> randomizeChoice;
 
-    vector<vector<int>> matrixA(matrixSize, vector<int>(matrixSize)),
-        matrixB(matrixSize, vector<int>(matrixSize)),
-        matrixC(matrixSize, vector<int>(matrixSize, 0));
+    // row-major n x n buffers, handed to the library as views
+    vector<int> matrixA(matrixSize * matrixSize),
+        matrixB(matrixSize * matrixSize),
+        matrixC(matrixSize * matrixSize, 0);
+    cannon::MatrixView viewA(matrixA.data(), matrixSize),
+        viewB(matrixB.data(), matrixSize),
+        viewC(matrixC.data(), matrixSize);
 
     if (randomizeChoice == 'y' || randomizeChoice == 'Y') {
         srand(time(0));
         for (int r = 0; r < matrixSize; ++r)
             for (int c = 0; c < matrixSize; ++c) {
-                matrixA[r][c] = rand() % 20;
-                matrixB[r][c] = rand() % 20;
+                viewA(r, c) = rand() % 20;
+                viewB(r, c) = rand() % 20;
             }
     #if PRINT_MAT == 1
-        cout << "\nMatrix A:\n"; printMatrix(matrixA);
-        cout << "Matrix B:\n"; printMatrix(matrixB);
+        cout << "\nMatrix A:\n"; printMatrix(viewA);
+        cout << "Matrix B:\n"; printMatrix(viewB);
     #endif
     }
     else {
         cout << "\nEnter A (" << matrixSize << " x " << matrixSize << "):\n";
         for (int r = 0; r < matrixSize; ++r)
             for (int c = 0; c < matrixSize; ++c)
-                cin >> matrixA[r][c];
+                cin >> viewA(r, c);
         cout << "\nEnter B (" << matrixSize << " x " << matrixSize << "):\n";
         for (int r = 0; r < matrixSize; ++r)
             for (int c = 0; c < matrixSize; ++c)
-                cin >> matrixB[r][c];
+                cin >> viewB(r, c);
     }
 
     int processCount;
@@ -290,6 +79,8 @@ int main() {
 
     double sqrtP = sqrt(double(processCount));
     int    nearestRoot = int(floor(sqrtP + 0.5));
+    int    gridSize = (nearestRoot * nearestRoot == processCount)
+        ? nearestRoot : int(ceil(sqrtP));
     if (nearestRoot * nearestRoot == processCount && matrixSize % nearestRoot == 0) {
         cout << "Using grid " << nearestRoot << " x " << nearestRoot
             << " with block size " << (matrixSize / nearestRoot) << ".\n\n";
@@ -302,10 +93,61 @@ int main() {
             << ", padded block size " << blockSize << ".\n\n";
     }
 
-    omp_set_num_threads(processCount);
+    int threadCount;
+    cout << "Use how many threads? (0 = one per core) ";
+    cin >> threadCount;
+    // asking for the default also lets a tuning file (written by
+    // cannon_bench --autotune) pick the process grid and thread count
+    bool useTunedLayout = threadCount <= 0;
+    if (threadCount <= 0)
+        threadCount = omp_get_num_procs();
+
+    char engineChoice;
+    cout << "Engine: (b)arrier steps, (t)ask dataflow or work-stealing (p)ool? ";
+    cin >> engineChoice;
+
+    cannon::Options options;
+    options.processCount = processCount;
+    options.threadCount = threadCount;
+    if (useTunedLayout)
+        options.tuningFile = cannon::defaultTuningFile();
+    else
+        cannon::loadKernelTiling(cannon::defaultTuningFile(),
+            (matrixSize + gridSize - 1) / gridSize, options.tiling);
+    if (engineChoice == 't' || engineChoice == 'T')
+        options.engine = cannon::Engine::OpenMPTasks;
+    else if (engineChoice == 'p' || engineChoice == 'P')
+        options.engine = cannon::Engine::Pool;
+    else
+        options.engine = cannon::Engine::OpenMP;
+
+    if (options.engine == cannon::Engine::OpenMP) {
+        char placementChoice;
+        cout << "Thread placement: (n)one, (c)ompact or (s)catter? ";
+        cin >> placementChoice;
+        if (placementChoice == 'c' || placementChoice == 'C')
+            options.affinity = cannon::Affinity::Compact;
+        else if (placementChoice == 's' || placementChoice == 'S')
+            options.affinity = cannon::Affinity::Scatter;
+    }
+
+    // the tuned layout, if one is used, decides the grid and the threads
+    if (useTunedLayout
+        && cannon::loadLayout(options.tuningFile, options.engine, matrixSize,
+            options.processCount, options.threadCount)) {
+        gridSize = int(ceil(sqrt(double(options.processCount))));
+        threadCount = options.threadCount;
+    }
+    cout << "Running " << gridSize * gridSize << " blocks on "
+        << threadCount << " threads.\n\n";
+
+    // the pool's threads are started before the clock, as they would be
+    // in a service that owns them
+    WorkStealingPool pool(options.engine == cannon::Engine::Pool ? threadCount : 1);
+    options.pool = &pool;
 
     auto start = chrono::high_resolution_clock::now();
-    cannonMultiply(matrixA, matrixB, matrixC, processCount);
+    cannon::multiply(viewA, viewB, viewC, options);
     auto stop = chrono::high_resolution_clock::now();
 
     auto duration = chrono::duration_cast<chrono::milliseconds>(stop - start);
@@ -313,7 +155,7 @@ int main() {
     cout << "Duration is " << duration.count() << " milliseconds\n";
     #if PRINT_MAT == 1
         cout << "Result C = A x B:\n";
-        printMatrix(matrixC);
+        printMatrix(viewC);
     #endif
     return 0;
 }
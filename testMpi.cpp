@@ -0,0 +1,665 @@
+#include <mpi.h>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cannonMpi.h"
+
+using namespace std;
+
+// Checks of the MPI engine against a plain triple loop on root. Run on 5
+// ranks (ctest does): the grid checks use ranks 0-3 as a 2 x 2 grid, so
+// every block is shifted, with n not a multiple of 2 wherever padding
+// matters; multiplyConcurrent gets all 5, one more than a square.
+
+// C = A x B in semiring, taken modulo modulus if it is not 0; PlusTimes
+// keeps the low 32 bits of each sum, as the engines do
+static std::vector<int> reference(const std::vector<int>& A,
+    const std::vector<int>& B, int n,
+    cannon::Semiring semiring = cannon::Semiring::PlusTimes, int modulus = 0)
+{
+    std::vector<int> C(n * n);
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            int64_t sum = semiring == cannon::Semiring::MinPlus ? cannon::infinity
+                : semiring == cannon::Semiring::MaxPlus ? -cannon::infinity : 0;
+            for (int k = 0; k < n; ++k)
+            {
+                int64_t a = A[i * n + k], b = B[k * n + j];
+                switch (semiring)
+                {
+                case cannon::Semiring::PlusTimes:
+                    sum += a * b;
+                    if (modulus != 0)
+                        sum %= modulus;
+                    break;
+                case cannon::Semiring::MinPlus:
+                    if (a != cannon::infinity && b != cannon::infinity)
+                        sum = std::min(sum, a + b);
+                    break;
+                case cannon::Semiring::MaxPlus:
+                    if (a != -cannon::infinity && b != -cannon::infinity)
+                        sum = std::max(sum, a + b);
+                    break;
+                case cannon::Semiring::BoolOrAnd:
+                    sum |= a != 0 && b != 0;
+                    break;
+                }
+            }
+            C[i * n + j] = int32_t(uint32_t(sum));
+        }
+    }
+    return C;
+}
+
+// On root: how many entries of C differ from expected, reported under name
+static int compare(const char* name, const std::vector<int>& C,
+    const std::vector<int>& expected)
+{
+    int wrong = 0;
+    for (size_t i = 0; i < C.size(); ++i)
+        wrong += C[i] != expected[i];
+    if (wrong > 0)
+        std::cerr << name << ": " << wrong << " of " << C.size()
+            << " entries of C are wrong\n";
+    return wrong;
+}
+
+// A test matrix: entry i is (i * step + offset) % range - shift
+static std::vector<int> pattern(int n, int step, int offset, int range, int shift)
+{
+    std::vector<int> M(n * n);
+    for (int i = 0; i < n * n; ++i)
+        M[i] = (i * step + offset) % range - shift;
+    return M;
+}
+
+// Runs A x B with options on the grid (ranks outside it pass
+// MPI_COMM_NULL) and, as A x B and B x A, through multiplyConcurrent on
+// comm. Returns options.root's count of wrong entries; the grid's ranks
+// are comm's first four
+static int checkProduct(const char* name, MPI_Comm grid, MPI_Comm comm,
+    int rank, int n, const std::vector<int>& A, const std::vector<int>& B,
+    const cannon::MpiOptions& options)
+{
+    cannon::ConstMatrixView a(A.data(), n), b(B.data(), n);
+    std::vector<int> C(n * n), D(n * n);
+    int wrong = 0;
+    if (grid != MPI_COMM_NULL)
+    {
+        cannon::multiply(a, b, cannon::MatrixView(C.data(), n), grid, options);
+        if (rank == options.root)
+            wrong += compare(name, C, reference(A, B, n, options.semiring, options.modulus));
+    }
+    std::fill(C.begin(), C.end(), 0);
+    cannon::multiplyConcurrent({ { a, b, cannon::MatrixView(C.data(), n) },
+        { b, a, cannon::MatrixView(D.data(), n) } },
+        comm, cannon::GridCostModel(), options);
+    if (rank == options.root)
+    {
+        std::string concurrent = std::string(name) + " (multiplyConcurrent)";
+        wrong += compare(concurrent.c_str(), C,
+            reference(A, B, n, options.semiring, options.modulus));
+        wrong += compare(concurrent.c_str(), D,
+            reference(B, A, n, options.semiring, options.modulus));
+    }
+    return wrong;
+}
+
+// 0 if call throws Exception on every rank of comm, 1 otherwise
+template <typename Exception, typename Call>
+static int expectThrow(const char* name, MPI_Comm comm, int rank, Call call)
+{
+    int threw = 0;
+    try
+    {
+        call();
+    }
+    catch (const Exception&)
+    {
+        threw = 1;
+    }
+    int everyone;
+    MPI_Allreduce(&threw, &everyone, 1, MPI_INT, MPI_MIN, comm);
+    if (rank == 0 && !everyone)
+        std::cerr << name << ": not every rank threw\n";
+    return everyone ? 0 : 1;
+}
+
+// Sparse shifts with 64-bit sums: entries are large enough that the sums
+// could pass INT_MAX, so the product runs with wide sums, and most of
+// them are zero, so blocks travel as CSR. C keeps the low 32 bits.
+static int checkSparseWideSums(MPI_Comm grid, int rank)
+{
+    const int n = 12;
+    std::vector<int> A(n * n, 0), B(n * n, 0), C(n * n, 0);
+    for (int i = 0; i < n * n; ++i)
+    {
+        if (i % 5 == 0)
+            A[i] = 40000 + i;
+        if (i % 7 == 3)
+            B[i] = -50000 + 3 * i;
+    }
+
+    cannon::MpiOptions options;
+    options.sparseDensity = 0.5;
+    cannon::multiply(cannon::ConstMatrixView(A.data(), n),
+        cannon::ConstMatrixView(B.data(), n),
+        cannon::MatrixView(C.data(), n), grid, options);
+    return rank == 0 ? compare("sparse shifts with wide sums", C, reference(A, B, n)) : 0;
+}
+
+// Products of different sizes on sub-grids of a communicator whose size
+// is not square
+static int checkConcurrent(MPI_Comm comm, int rank)
+{
+    const int sizes[3] = { 7, 5, 11 };
+    std::vector<std::vector<int>> As, Bs, Cs;
+    std::vector<cannon::Product> products;
+    for (int p = 0; p < 3; ++p)
+    {
+        int n = sizes[p];
+        As.push_back(pattern(n, 7, p, 13, 6));
+        Bs.push_back(pattern(n, 5, 3 * p, 11, 5));
+        Cs.emplace_back(n * n, 0);
+    }
+    for (int p = 0; p < 3; ++p)
+        products.push_back({ cannon::ConstMatrixView(As[p].data(), sizes[p]),
+            cannon::ConstMatrixView(Bs[p].data(), sizes[p]),
+            cannon::MatrixView(Cs[p].data(), sizes[p]) });
+    cannon::multiplyConcurrent(products, comm);
+
+    int wrong = 0;
+    for (int p = 0; rank == 0 && p < 3; ++p)
+        wrong += compare("multiplyConcurrent", Cs[p], reference(As[p], Bs[p], sizes[p]));
+    return wrong;
+}
+
+// Options no sub-grid accepts must make every rank throw, not just the
+// sub-grids that try them, even with the products split between groups
+static int checkConcurrentBadOptions(MPI_Comm comm, int rank)
+{
+    const int n = 6;
+    std::vector<int> A = pattern(n, 7, 0, 13, 6), B = A, C(n * n), D(n * n);
+    cannon::MpiOptions options;
+    options.sparseDensity = 0.5;
+    options.compressBytesPerSecond = 1e9;
+    options.checkOverflow = true;
+    return expectThrow<std::invalid_argument>("multiplyConcurrent with bad options",
+        comm, rank, [&]() {
+            cannon::ConstMatrixView a(A.data(), n), b(B.data(), n);
+            cannon::multiplyConcurrent({ { a, b, cannon::MatrixView(C.data(), n) },
+                { a, b, cannon::MatrixView(D.data(), n) } },
+                comm, cannon::GridCostModel(), options);
+        });
+}
+
+// Int8 and Int16 operands with int sums; entries that do not fit the
+// precision are refused on every rank
+static int checkNarrowPrecision(MPI_Comm grid, MPI_Comm comm, int rank)
+{
+    const int n = 9;
+    cannon::MpiOptions options;
+    options.precision = cannon::Precision::Int8;
+    int wrong = checkProduct("Int8 operands", grid, comm, rank, n,
+        pattern(n, 37, 1, 256, 128), pattern(n, 53, 7, 256, 128), options);
+    options.precision = cannon::Precision::Int16;
+    wrong += checkProduct("Int16 operands", grid, comm, rank, n,
+        pattern(n, 977, 3, 6001, 3000), pattern(n, 631, 5, 6001, 3000), options);
+
+    options.precision = cannon::Precision::Int8;
+    std::vector<int> A = pattern(n, 37, 1, 256, 128), C(n * n);
+    A[n + 2] = 128;
+    return wrong + expectThrow<std::invalid_argument>("Int8 operand out of range",
+        comm, rank, [&]() {
+            cannon::multiplyConcurrent({ { cannon::ConstMatrixView(A.data(), n),
+                cannon::ConstMatrixView(A.data(), n), cannon::MatrixView(C.data(), n) } },
+                comm, cannon::GridCostModel(), options);
+        });
+}
+
+// Sparse shifts of mostly zero operands, with whole blocks of zeros to
+// skip: on the 2 x 2 grid A's block (0, 1) and B's block (1, 0) are
+// empty, so some local products have nothing to do
+static int checkSparse(MPI_Comm grid, MPI_Comm comm, int rank)
+{
+    const int n = 9;
+    std::vector<int> A(n * n, 0), B(n * n, 0);
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            if (!(i < 5 && j >= 5) && (i * n + j) % 4 == 1)
+                A[i * n + j] = (i * 13 + j) % 19 - 9;
+            if (!(i >= 5 && j < 5) && (i + j) % 3 == 0)
+                B[i * n + j] = (i * 7 + j * 3) % 23 - 11;
+        }
+    }
+    cannon::MpiOptions options;
+    options.sparseDensity = 0.5;
+    int wrong = checkProduct("sparse operands", grid, comm, rank, n, A, B, options);
+    std::vector<int> zeros(n * n, 0);
+    return wrong + checkProduct("all-zero operand", grid, comm, rank, n, A, zeros, options);
+}
+
+// A graph on n nodes for the path semirings: edge i -> j of weight 1-9
+// on some pairs, "no edge" (none) elsewhere and 0 on the diagonal
+static std::vector<int> graph(int n, int none)
+{
+    std::vector<int> G(n * n, none);
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            if (i == j)
+                G[i * n + j] = 0;
+            else if ((i * 5 + j * 3) % 7 < 2)
+                G[i * n + j] = (i * 3 + j) % 9 + 1;
+        }
+    }
+    return G;
+}
+
+// Every semiring, and repeated squaring for shortest paths and
+// reachability, which keeps each square on the grid
+static int checkSemirings(MPI_Comm grid, MPI_Comm comm, int rank)
+{
+    const int n = 9;
+    cannon::MpiOptions options;
+    options.semiring = cannon::Semiring::MinPlus;
+    std::vector<int> shortest = graph(n, cannon::infinity);
+    int wrong = checkProduct("MinPlus", grid, comm, rank, n, shortest,
+        graph(n, cannon::infinity), options);
+    options.sparseDensity = 0.5;
+    wrong += checkProduct("sparse MinPlus", grid, comm, rank, n, shortest,
+        shortest, options);
+    options.sparseDensity = 0;
+    options.semiring = cannon::Semiring::MaxPlus;
+    wrong += checkProduct("MaxPlus", grid, comm, rank, n, graph(n, -cannon::infinity),
+        pattern(n, 7, 2, 15, 7), options);
+    options.semiring = cannon::Semiring::BoolOrAnd;
+    std::vector<int> edges = graph(n, 0);
+    wrong += checkProduct("BoolOrAnd", grid, comm, rank, n, edges,
+        pattern(n, 5, 1, 3, 0), options);
+
+    if (grid == MPI_COMM_NULL)
+        return wrong;
+    // ceil(log2(n - 1)) = 3 squarings cover every path
+    const cannon::Semiring squared[2] = { cannon::Semiring::MinPlus,
+        cannon::Semiring::BoolOrAnd };
+    for (cannon::Semiring semiring : squared)
+    {
+        std::vector<int> A = semiring == cannon::Semiring::MinPlus ? shortest : edges;
+        std::vector<int> C(n * n);
+        options.semiring = semiring;
+        cannon::repeatedSquaring(cannon::ConstMatrixView(A.data(), n),
+            cannon::MatrixView(C.data(), n), grid, -1, options);
+        if (rank == 0)
+        {
+            std::vector<int> expected = A;
+            for (int s = 0; s < 3; ++s)
+                expected = reference(expected, expected, n, semiring);
+            wrong += compare("repeatedSquaring", C, expected);
+        }
+    }
+    return wrong;
+}
+
+// Products modulo a prime just under INT_MAX, with entries up to it so
+// the true sums are far past 64 bits, and modulo a small one; entries
+// outside [0, modulus) are refused on every rank
+static int checkModulus(MPI_Comm grid, MPI_Comm comm, int rank)
+{
+    const int n = 9;
+    const int large = 2147483629;
+    std::vector<int> A(n * n), B(n * n);
+    for (int i = 0; i < n * n; ++i)
+    {
+        A[i] = int((int64_t(i) * 1234567891 + 17) % large);
+        B[i] = int((int64_t(i) * 987654323 + large - 1) % large);
+    }
+    cannon::MpiOptions options;
+    options.modulus = large;
+    int wrong = checkProduct("modulus near INT_MAX", grid, comm, rank, n, A, B, options);
+    options.modulus = 7;
+    wrong += checkProduct("modulus 7", grid, comm, rank, n, pattern(n, 3, 1, 7, 0),
+        pattern(n, 5, 2, 7, 0), options);
+
+    if (grid != MPI_COMM_NULL)
+    {
+        // two squarings, so the second squares a result left on the grid
+        std::vector<int> C(n * n);
+        options.modulus = large;
+        cannon::repeatedSquaring(cannon::ConstMatrixView(A.data(), n),
+            cannon::MatrixView(C.data(), n), grid, 2, options);
+        if (rank == 0)
+        {
+            std::vector<int> expected = reference(A, A, n, cannon::Semiring::PlusTimes, large);
+            expected = reference(expected, expected, n, cannon::Semiring::PlusTimes, large);
+            wrong += compare("repeatedSquaring with a modulus", C, expected);
+        }
+    }
+
+    options.modulus = 7;
+    std::vector<int> outside = pattern(n, 3, 1, 7, 0), C(n * n);
+    outside[4] = 7;
+    return wrong + expectThrow<std::invalid_argument>("entry outside [0, modulus)",
+        comm, rank, [&]() {
+            cannon::multiplyConcurrent({ { cannon::ConstMatrixView(outside.data(), n),
+                cannon::ConstMatrixView(outside.data(), n), cannon::MatrixView(C.data(), n) } },
+                comm, cannon::GridCostModel(), options);
+        });
+}
+
+// Every rank: how many entries of its block of X differ from expected,
+// or from zero in the padding past n
+static int compareBlock(const char* name, const cannon::DistributedMatrix& X,
+    const std::vector<int>& expected, int zero = 0)
+{
+    const cannon::BlockLayout& layout = X.layout;
+    int wrong = 0;
+    for (int i = 0; i < layout.blockSize; ++i)
+    {
+        for (int j = 0; j < layout.blockSize; ++j)
+        {
+            int row = layout.rowBegin(X.blockRow) + i, col = layout.colBegin(X.blockCol) + j;
+            bool inside = row < layout.n && col < layout.n;
+            wrong += X(i, j) != (inside ? expected[row * layout.n + col] : zero);
+        }
+    }
+    if (wrong > 0)
+        std::cerr << name << ": " << wrong << " entries of block (" << X.blockRow
+            << ", " << X.blockCol << ") are wrong\n";
+    return wrong;
+}
+
+// Results left on the grid: each rank's block, chained products of
+// distributed operands, and the gather back to root
+static int checkDistributed(MPI_Comm grid, int rank)
+{
+    const int n = 9;
+    std::vector<int> A = pattern(n, 7, 1, 13, 6), B = pattern(n, 5, 4, 11, 5),
+        D = pattern(n, 3, 2, 17, 8), C(n * n);
+    cannon::ConstMatrixView a(A.data(), n), b(B.data(), n), d(D.data(), n);
+    std::vector<int> AB = reference(A, B, n);
+
+    cannon::MpiBatch batch(n, grid);
+    cannon::DistributedMatrix X = batch.multiplyDistributed(a, b);
+    int wrong = compareBlock("multiplyDistributed", X, AB);
+    wrong += compareBlock("multiplyDistributed of a distributed X",
+        batch.multiplyDistributed(X, d), reference(AB, D, n));
+    cannon::DistributedMatrix Y = batch.distribute(d);
+    wrong += compareBlock("distribute", Y, D);
+    wrong += compareBlock("multiplyDistributed of distributed X and Y",
+        batch.multiplyDistributed(X, Y), reference(AB, D, n));
+
+    batch.gather(X, cannon::MatrixView(C.data(), n));
+    if (rank == 0)
+        wrong += compare("gather", C, AB);
+    return wrong;
+}
+
+// Chained products and powers, including X^0 (the identity) and a
+// MinPlus power
+static int checkChainAndPower(MPI_Comm grid, int rank)
+{
+    const int n = 9;
+    std::vector<int> A = pattern(n, 7, 1, 5, 2), B = pattern(n, 5, 4, 5, 2),
+        D = pattern(n, 3, 2, 5, 2), C(n * n);
+    cannon::chainProduct({ cannon::ConstMatrixView(A.data(), n),
+        cannon::ConstMatrixView(B.data(), n), cannon::ConstMatrixView(D.data(), n) },
+        cannon::MatrixView(C.data(), n), grid);
+    int wrong = 0;
+    if (rank == 0)
+        wrong += compare("chainProduct", C, reference(reference(A, B, n), D, n));
+
+    const int powers[3] = { 0, 1, 5 };
+    for (int k : powers)
+    {
+        cannon::matrixPower(cannon::ConstMatrixView(A.data(), n), k,
+            cannon::MatrixView(C.data(), n), grid);
+        if (rank == 0)
+        {
+            std::vector<int> expected(n * n, 0);
+            for (int i = 0; i < n; ++i)
+                expected[i * n + i] = 1;
+            for (int i = 0; i < k; ++i)
+                expected = reference(expected, A, n);
+            wrong += compare("matrixPower", C, expected);
+        }
+    }
+
+    cannon::MpiOptions options;
+    options.semiring = cannon::Semiring::MinPlus;
+    std::vector<int> G = graph(n, cannon::infinity);
+    cannon::matrixPower(cannon::ConstMatrixView(G.data(), n), 6,
+        cannon::MatrixView(C.data(), n), grid, options);
+    if (rank == 0)
+    {
+        std::vector<int> expected = G;
+        for (int i = 1; i < 6; ++i)
+            expected = reference(expected, G, n, cannon::Semiring::MinPlus);
+        wrong += compare("MinPlus matrixPower", C, expected);
+    }
+    return wrong;
+}
+
+// Bit-packed shifts on a link slow enough that packing always pays:
+// blocks of a few bits, a constant block, entries spanning the whole int
+// range (sums in 64 bits) and Int8 operands
+static int checkCompressed(MPI_Comm grid, MPI_Comm comm, int rank)
+{
+    const int n = 9;
+    cannon::MpiOptions options;
+    options.compressBytesPerSecond = 1;
+    int wrong = checkProduct("compressed shifts", grid, comm, rank, n,
+        pattern(n, 7, 1, 13, 6), pattern(n, 5, 4, 3, 1000), options);
+
+    std::vector<int> A = pattern(n, 3, 2, 9, 4), B(n * n, 5);
+    for (int i = 0; i < n * n; i += 4)
+        A[i] = i % 8 == 0 ? INT_MAX : INT_MIN;
+    wrong += checkProduct("compressed shifts, full range", grid, comm, rank, n,
+        A, B, options);
+
+    options.precision = cannon::Precision::Int8;
+    return wrong + checkProduct("compressed Int8 shifts", grid, comm, rank, n,
+        pattern(n, 37, 1, 256, 128), pattern(n, 11, 3, 16, 8), options);
+}
+
+// Node-aware placement with a root other than rank 0. On one node the
+// placement keeps comm's order, so this checks the products and that the
+// layout names the rank that holds each block
+static int checkNodeAware(MPI_Comm grid, MPI_Comm comm, int rank)
+{
+    const int n = 9;
+    std::vector<int> A = pattern(n, 7, 1, 13, 6), B = pattern(n, 5, 4, 11, 5);
+    cannon::MpiOptions options;
+    options.nodeAware = true;
+    options.root = 2;
+    int wrong = 0;
+    if (grid != MPI_COMM_NULL)
+    {
+        cannon::MpiBatch batch(n, grid, options);
+        cannon::DistributedMatrix X = batch.multiplyDistributed(
+            cannon::ConstMatrixView(A.data(), n), cannon::ConstMatrixView(B.data(), n));
+        wrong += compareBlock("node-aware multiplyDistributed", X, reference(A, B, n));
+        int gridRank;
+        MPI_Comm_rank(grid, &gridRank);
+        if (X.layout.owner(X.blockRow, X.blockCol) != gridRank)
+        {
+            std::cerr << "node-aware layout: block (" << X.blockRow << ", "
+                << X.blockCol << ") is not where the layout says\n";
+            ++wrong;
+        }
+    }
+    return wrong + checkProduct("node-aware placement", grid, comm, rank, n, A, B, options);
+}
+
+// ABFT against injected faults: one wrong C entry is put right; a wrong
+// A entry after a shift, or one checksum of C off on its own, cannot be
+// told from other faults, so the product is flagged and C left alone
+static int checkAbft(MPI_Comm grid, int rank)
+{
+    const int n = 9;
+    std::vector<int> A = pattern(n, 7, 1, 13, 6), B = pattern(n, 5, 4, 11, 5),
+        C(n * n);
+    std::vector<int> expected = reference(A, B, n);
+    cannon::ConstMatrixView a(A.data(), n), b(B.data(), n);
+    cannon::MatrixView c(C.data(), n);
+    cannon::MpiOptions options;
+    options.abft = true;
+    typedef cannon::detail::InjectedFault Fault;
+    int wrong = 0;
+
+    {
+        cannon::detail::injectFault({ Fault::CEntry, 1, 0 });
+        cannon::MpiBatch batch(n, grid, options);
+        batch.multiply({ a }, { b }, { c });
+        long long corrected = batch.correctedEntries(), total;
+        MPI_Allreduce(&corrected, &total, 1, MPI_LONG_LONG, MPI_SUM, grid);
+        if (rank == 0)
+        {
+            wrong += compare("ABFT with a wrong C entry", C, expected);
+            if (total != 1)
+            {
+                std::cerr << "ABFT with a wrong C entry: " << total << " entries put right\n";
+                ++wrong;
+            }
+        }
+    }
+
+    // the product is flagged, and the flip leaves nothing to put right
+    {
+        cannon::detail::injectFault({ Fault::AEntry, 2, 0 });
+        cannon::MpiBatch batch(n, grid, options);
+        wrong += expectThrow<std::runtime_error>("ABFT with a wrong A entry", grid, rank,
+            [&]() { batch.multiply({ a }, { b }, { c }); });
+        if (batch.correctedEntries() != 0)
+        {
+            std::cerr << "ABFT with a wrong A entry: rank " << rank << " patched C\n";
+            ++wrong;
+        }
+    }
+
+    const Fault checksums[2] = { { Fault::RowChecksum, 3, 1 },
+        { Fault::ColumnChecksum, 0, 0 } };
+    for (const Fault& checksum : checksums)
+    {
+        cannon::detail::injectFault(checksum);
+        std::fill(C.begin(), C.end(), 0);
+        cannon::MpiBatch batch(n, grid, options);
+        wrong += expectThrow<std::runtime_error>("ABFT with a wrong checksum", grid, rank,
+            [&]() { batch.multiply({ a }, { b }, { c }); });
+        if (rank == 0)
+            wrong += compare("ABFT with a wrong checksum", C, expected);
+    }
+    cannon::detail::injectFault({});
+    return wrong;
+}
+
+static bool fileExists(const std::string& path)
+{
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (file)
+        std::fclose(file);
+    return file != nullptr;
+}
+
+// Checkpoint every step, stop the batch after its first checkpoint and
+// restart it. The restart is handed zeros for A and B, so only a run
+// that resumed from the saved blocks can still match the product of an
+// uncheckpointed run. Files go to the working directory and must all be
+// gone once the restarted batch is done
+static int checkResume(MPI_Comm grid, int rank)
+{
+    const int n = 9;
+    std::vector<int> A = pattern(n, 7, 1, 13, 6), B = pattern(n, 5, 4, 11, 5),
+        zeros(n * n, 0), plain(n * n), C(n * n);
+    cannon::ConstMatrixView a(A.data(), n), b(B.data(), n), z(zeros.data(), n);
+    cannon::multiply(a, b, cannon::MatrixView(plain.data(), n), grid);
+
+    cannon::MpiOptions options;
+    options.checkpointEvery = 1;
+    options.checkpointDir = ".";
+    std::string prefix = "./cannon-" + std::to_string(rank);
+    int wrong = 0;
+    {
+        cannon::detail::injectFault({ cannon::detail::InjectedFault::Stop, 0, 0 });
+        cannon::MpiBatch batch(n, grid, options);
+        wrong += expectThrow<std::runtime_error>("stopped checkpointing batch", grid, rank,
+            [&]() { batch.multiply({ a }, { b }, { cannon::MatrixView(C.data(), n) }); });
+        cannon::detail::injectFault({});
+    }
+    if (!fileExists(prefix + ".job")
+        || !(fileExists(prefix + "-0.0") || fileExists(prefix + "-0.1")))
+    {
+        std::cerr << "stopped checkpointing batch: rank " << rank << " left no checkpoint\n";
+        ++wrong;
+    }
+
+    options.restart = true;
+    {
+        cannon::MpiBatch batch(n, grid, options);
+        batch.multiply({ z }, { z }, { cannon::MatrixView(C.data(), n) });
+    }
+    if (rank == 0)
+        wrong += compare("resumed from a checkpoint", C, plain);
+    if (fileExists(prefix + ".job") || fileExists(prefix + "-0.0")
+        || fileExists(prefix + "-0.1"))
+    {
+        std::cerr << "finished checkpointing batch: rank " << rank << " left files behind\n";
+        ++wrong;
+    }
+    return wrong;
+}
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if (size < 4)
+    {
+        if (rank == 0)
+            std::cerr << "Run on at least 4 ranks\n";
+        MPI_Finalize();
+        return 1;
+    }
+
+    // ranks 0-3 form the 2 x 2 grid; rank 0 of it is rank 0 here
+    MPI_Comm grid;
+    MPI_Comm_split(MPI_COMM_WORLD, rank < 4 ? 0 : MPI_UNDEFINED, rank, &grid);
+
+    int failed = 0;
+    if (grid != MPI_COMM_NULL)
+    {
+        failed += checkSparseWideSums(grid, rank);
+        failed += checkDistributed(grid, rank);
+        failed += checkChainAndPower(grid, rank);
+        failed += checkAbft(grid, rank);
+        failed += checkResume(grid, rank);
+    }
+    failed += checkConcurrent(MPI_COMM_WORLD, rank);
+    failed += checkConcurrentBadOptions(MPI_COMM_WORLD, rank);
+    failed += checkNarrowPrecision(grid, MPI_COMM_WORLD, rank);
+    failed += checkSparse(grid, MPI_COMM_WORLD, rank);
+    failed += checkSemirings(grid, MPI_COMM_WORLD, rank);
+    failed += checkModulus(grid, MPI_COMM_WORLD, rank);
+    failed += checkCompressed(grid, MPI_COMM_WORLD, rank);
+    failed += checkNodeAware(grid, MPI_COMM_WORLD, rank);
+
+    if (grid != MPI_COMM_NULL)
+        MPI_Comm_free(&grid);
+
+    MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Finalize();
+    return failed != 0;
+}
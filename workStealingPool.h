@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small work-stealing thread pool for the shared-memory Cannon engine.
+// It needs nothing but the C++ standard library, so it can be used where
+// no OpenMP runtime is available.
+//
+// parallelFor(count, body) runs body(0) .. body(count - 1) and returns
+// once all of them have finished. The indices are dealt out to one deque
+// per thread (the calling thread is worker 0 and takes part); a thread
+// pops from the back of its own deque and, once that is empty, steals
+// from the front of the others.
+//
+// Cancellation is cooperative: after cancel() the tasks that have not
+// started yet are skipped and parallelFor returns false. Callers check
+// cancelled() between phases; resetCancel() re-arms the pool.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int threadCount)
+    {
+        if (threadCount < 1)
+            threadCount = 1;
+        for (int t = 0; t < threadCount; ++t)
+            queues.push_back(std::make_unique<TaskQueue>());
+        for (int t = 1; t < threadCount; ++t)
+            workers.emplace_back([this, t] { workerLoop(t); });
+    }
+
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(stateLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int size() const { return int(queues.size()); }
+
+    void cancel() { cancelRequested = true; }
+    void resetCancel() { cancelRequested = false; }
+    bool cancelled() const { return cancelRequested; }
+
+    bool parallelFor(int taskCount, const std::function<void(int)>& taskBody)
+    {
+        if (taskCount <= 0)
+            return !cancelled();
+        {
+            std::lock_guard<std::mutex> guard(stateLock);
+            body = &taskBody;
+            remaining = taskCount;
+            // contiguous chunks keep neighbouring blocks on one thread
+            // until somebody runs dry and starts stealing
+            int threadCount = size();
+            for (int t = 0; t < threadCount; ++t) {
+                int first = int((long long)taskCount * t / threadCount);
+                int last = int((long long)taskCount * (t + 1) / threadCount);
+                std::lock_guard<std::mutex> queueGuard(queues[t]->lock);
+                for (int i = first; i < last; ++i)
+                    queues[t]->tasks.push_back(i);
+            }
+            ++generation;
+        }
+        wake.notify_all();
+
+        while (runOne(0)) {
+        }
+        std::unique_lock<std::mutex> guard(stateLock);
+        done.wait(guard, [this] { return remaining == 0; });
+        body = nullptr;
+        return !cancelled();
+    }
+
+private:
+    struct TaskQueue {
+        std::mutex lock;
+        std::deque<int> tasks;
+    };
+
+    // Pop a task (own deque first, then steal) and run it.
+    // Returns false when every deque is empty.
+    bool runOne(int self)
+    {
+        int task = -1;
+        {
+            std::lock_guard<std::mutex> guard(queues[self]->lock);
+            if (!queues[self]->tasks.empty()) {
+                task = queues[self]->tasks.back();
+                queues[self]->tasks.pop_back();
+            }
+        }
+        for (int k = 1; task < 0 && k < size(); ++k) {
+            TaskQueue& victim = *queues[(self + k) % size()];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+            }
+        }
+        if (task < 0)
+            return false;
+
+        if (!cancelled())
+            (*body)(task);
+        if (--remaining == 0) {
+            std::lock_guard<std::mutex> guard(stateLock);
+            done.notify_all();
+        }
+        return true;
+    }
+
+    void workerLoop(int self)
+    {
+        unsigned long long seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> guard(stateLock);
+                wake.wait(guard, [&] { return stopping || generation != seen; });
+                if (stopping)
+                    return;
+                seen = generation;
+            }
+            while (runOne(self)) {
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex stateLock;
+    std::condition_variable wake, done;
+    const std::function<void(int)>* body = nullptr;
+    std::atomic<int> remaining{0};
+    unsigned long long generation = 0;
+    bool stopping = false;
+    std::atomic<bool> cancelRequested{false};
+};